@@ -4,12 +4,21 @@
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AI/CombatAIController.h"
-#include "Components/WidgetComponent.h"
+#include "BrainComponent.h"
 #include "Engine/DamageEvents.h"
-#include "UI/CombatLifeBar.h"
+#include "Subsystems/LifeBarSubsystem.h"
 #include "TimerManager.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Animation/AnimInstance.h"
+#include "Subsystems/AimableRegistrySubsystem.h"
+#include "Interfaces/InterfaceDispatchCache.h"
+#include "Subsystems/CombatDamageSubsystem.h"
+#include "Subsystems/HurtboxRegistrySubsystem.h"
+#include "Gameplay/CombatCollision.h"
+#include "Data/CombatMontageBake.h"
+#include "Data/VariantAssetBundles.h"
+#include "Subsystems/RagdollBudgetSubsystem.h"
+#include "Subsystems/AILODSubsystem.h"
 
 ACombatEnemy::ACombatEnemy()
 {
@@ -27,13 +36,17 @@ ACombatEnemy::ACombatEnemy()
 	// ignore the controller's yaw rotation
 	bUseControllerRotationYaw = false;
 
-	// create the life bar
-	LifeBar = CreateDefaultSubobject<UWidgetComponent>(TEXT("LifeBar"));
-	LifeBar->SetupAttachment(RootComponent);
-
 	// set the collision capsule size
 	GetCapsuleComponent()->SetCapsuleSize(35.0f, 90.0f);
 
+	// create the hurtbox on the enemy faction channel, only player attacks see it
+	Hurtbox = CreateDefaultSubobject<UCapsuleComponent>(TEXT("Hurtbox"));
+	Hurtbox->SetupAttachment(RootComponent);
+	Hurtbox->SetCapsuleSize(35.0f, 90.0f);
+	Hurtbox->SetCollisionProfileName(CombatCollision::EnemyHurtboxProfile);
+	Hurtbox->SetGenerateOverlapEvents(false);
+	Hurtbox->SetCanEverAffectNavigation(false);
+
 	// set the character movement properties
 	GetCharacterMovement()->bUseControllerDesiredRotation = true;
 
@@ -58,18 +71,8 @@ void ACombatEnemy::DoAIComboAttack()
 	// reset the attack counter
 	CurrentComboAttack = 0;
 
-	// play the attack montage
-	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
-	{
-		const float MontageLength = AnimInstance->Montage_Play(ComboAttackMontage, 1.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
-
-		// subscribe to montage completed and interrupted events
-		if (MontageLength > 0.0f)
-		{
-			// set the end delegate for the montage
-			AnimInstance->Montage_SetEndDelegate(OnAttackMontageEnded, ComboAttackMontage);
-		}
-	}
+	// play the attack from its bake or montage
+	PlayAttack(ComboAttackMontage, ComboAttackBake);
 }
 
 void ACombatEnemy::DoAIChargedAttack()
@@ -89,25 +92,86 @@ void ACombatEnemy::DoAIChargedAttack()
 	// reset the charge loop counter
 	CurrentChargeLoop = 0;
 
-	// play the attack montage
+	// play the attack from its bake or montage
+	PlayAttack(ChargedAttackMontage, ChargedAttackBake);
+}
+
+bool ACombatEnemy::ShouldUseBakedAttacks() const
+{
+	// nobody sees the attack animation on a dedicated server or while we're off screen
+	return GetNetMode() == NM_DedicatedServer || !GetMesh()->WasRecentlyRendered(0.2f);
+}
+
+void ACombatEnemy::PlayAttack(const TSoftObjectPtr<UAnimMontage>& MontagePtr, UCombatMontageBake* Bake)
+{
+	// a new attack replaces a baked one that's still playing, which ends as interrupted like a replaced montage would
+	if (BakedAttack.IsPlaying())
+	{
+		BakedAttack.Stop(*this);
+		AttackMontageEnded(nullptr, true);
+
+		// the StateTree may have started its next attack from the completion; that one takes over
+		if (bIsAttacking)
+		{
+			return;
+		}
+
+		bIsAttacking = true;
+	}
+
+	if (Bake && ShouldUseBakedAttacks() && BakedAttack.Play(Bake))
+	{
+		return;
+	}
+
+	// the montage is normally loaded by now; if it isn't, finish loading it rather than drop the attack
+	UAnimMontage* Montage = VariantAssets::Resolve(MontagePtr);
+
 	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 	{
-		const float MontageLength = AnimInstance->Montage_Play(ChargedAttackMontage, 1.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
+		const float MontageLength = AnimInstance->Montage_Play(Montage, 1.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
 
 		// subscribe to montage completed and interrupted events
 		if (MontageLength > 0.0f)
 		{
 			// set the end delegate for the montage
-			AnimInstance->Montage_SetEndDelegate(OnAttackMontageEnded, ChargedAttackMontage);
+			AnimInstance->Montage_SetEndDelegate(OnAttackMontageEnded, Montage);
 		}
 	}
 }
 
+void ACombatEnemy::JumpToAttackSection(FName SectionName, UAnimMontage* Montage)
+{
+	if (BakedAttack.IsPlaying())
+	{
+		BakedAttack.JumpToSection(SectionName);
+	}
+	else if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->Montage_JumpToSection(SectionName, Montage);
+	}
+}
+
+FVector ACombatEnemy::GetDamageSourceLocation(FName DamageSourceBone) const
+{
+	// baked attacks carry their own bone positions; the pose isn't evaluated while they play
+	FVector Location;
+	if (BakedAttack.IsPlaying() && BakedAttack.SampleBone(DamageSourceBone, *GetMesh(), Location))
+	{
+		return Location;
+	}
+
+	return GetMesh()->GetSocketLocation(DamageSourceBone);
+}
+
 void ACombatEnemy::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 {
 	// reset the attacking flag
 	bIsAttacking = false;
 
+	// an interrupted montage may never reach the end of its swing window
+	SwingTrace.End();
+
 	// call the attack completed delegate so the StateTree can continue execution
 	OnAttackCompleted.ExecuteIfBound();
 }
@@ -118,46 +182,66 @@ void ACombatEnemy::DoAttackTrace(FName DamageSourceBone)
 	TArray<FHitResult> OutHits;
 
 	// start at the provided socket location, sweep forward
-	const FVector TraceStart = GetMesh()->GetSocketLocation(DamageSourceBone);
+	const FVector TraceStart = GetDamageSourceLocation(DamageSourceBone);
 	const FVector TraceEnd = TraceStart + (GetActorForwardVector() * MeleeTraceDistance);
 
-	// enemies only affect Pawn collision objects; they don't knock back boxes
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
-
-	// use a sphere shape for the sweep
-	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
-
-	// ignore self
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-
-	if (GetWorld()->SweepMultiByObjectType(OutHits, TraceStart, TraceEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams))
+	// enemies only sweep the player's hurtbox; they don't hit each other or knock back boxes
+	if (UHurtboxRegistrySubsystem::SweepMelee(*GetWorld(), TraceStart, TraceEnd, MeleeTraceRadius, EHurtboxFaction::Player, this, OutHits))
 	{
 		// iterate over each object hit
 		for (const FHitResult& CurrentHit : OutHits)
 		{
-			/** does the actor have the player tag? */
-			if (CurrentHit.GetActor()->ActorHasTag(FName("Player")))
-			{
-				// check if the actor is damageable
-				ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor());
+			ApplyMeleeHit(CurrentHit);
+		}
+	}
+}
+
+void ACombatEnemy::ApplyMeleeHit(const FHitResult& Hit)
+{
+	// the sweep only returns player hurtboxes, so no faction filtering is needed here
+	if (FInterfaceDispatchCache::GetDamageable(Hit.GetActor()))
+	{
+		// knock upwards and away from the impact normal
+		const FVector Impulse = (Hit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
 
-				if (Damageable)
-				{
-					// knock upwards and away from the impact normal
-					const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+		// queue the damage event for this frame's drain
+		UCombatDamageSubsystem::ApplyOrQueueDamage(Hit.GetActor(), MeleeDamage, this, Hit.ImpactPoint, Impulse);
+	}
+}
 
-					// pass the damage event to the actor
-					Damageable->ApplyDamage(MeleeDamage, this, CurrentHit.ImpactPoint, Impulse);
+void ACombatEnemy::BeginAttackSwing(FName DamageSourceBone)
+{
+	// start following the bone and sweep its starting position right away
+	SwingTrace.Begin(GetMesh(), DamageSourceBone);
+	TickAttackSwing();
+}
 
-				}
-			}
+void ACombatEnemy::TickAttackSwing()
+{
+	if (!SwingTrace.IsActive())
+	{
+		return;
+	}
+
+	// enemies only sweep the player's hurtbox; baked attacks supply the bone position themselves
+	const bool bHitNew = BakedAttack.IsPlaying()
+		? SwingTrace.AdvanceTo(*GetWorld(), GetDamageSourceLocation(SwingTrace.GetSourceName()), EHurtboxFaction::Player, MeleeTraceRadius, this, SwingHits)
+		: SwingTrace.Advance(*GetWorld(), EHurtboxFaction::Player, MeleeTraceRadius, this, SwingHits);
+
+	if (bHitNew)
+	{
+		for (const FHitResult& CurrentHit : SwingHits)
+		{
+			ApplyMeleeHit(CurrentHit);
 		}
 	}
 }
 
+void ACombatEnemy::EndAttackSwing()
+{
+	SwingTrace.End();
+}
+
 void ACombatEnemy::CheckCombo()
 {
 	// increase the combo counter
@@ -167,10 +251,7 @@ void ACombatEnemy::CheckCombo()
 	if (CurrentComboAttack < TargetComboCount)
 	{
 		// jump to the next attack section
-		if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
-		{
-			AnimInstance->Montage_JumpToSection(ComboSectionNames[CurrentComboAttack], ComboAttackMontage);
-		}
+		JumpToAttackSection(ComboSectionNames[CurrentComboAttack], ComboAttackMontage.Get());
 	}
 }
 
@@ -180,10 +261,7 @@ void ACombatEnemy::CheckChargedAttack()
 	++CurrentChargeLoop;
 
 	// jump to either the loop or attack section of the montage depending on whether we hit the loop target
-	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
-	{
-		AnimInstance->Montage_JumpToSection(CurrentChargeLoop >= TargetChargeLoops ? ChargeAttackSection : ChargeLoopSection, ChargedAttackMontage);
-	}
+	JumpToAttackSection(CurrentChargeLoop >= TargetChargeLoops ? ChargeAttackSection : ChargeLoopSection, ChargedAttackMontage.Get());
 }
 
 void ACombatEnemy::ApplyDamage(float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse)
@@ -206,11 +284,32 @@ void ACombatEnemy::ApplyDamage(float Damage, AActor* DamageCauser, const FVector
 			GetMesh()->AddImpulseAtLocation(DamageImpulse * GetMesh()->GetMass(), DamageLocation);
 		}
 
-		// stop the attack montages to interrupt the attack
+		// stop the attack montages to interrupt the attack. A montage that never loaded can't be playing,
+		// and a null montage would stop every montage on the mesh
 		if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
 		{
-			AnimInstance->Montage_Stop(0.1f, ComboAttackMontage);
-			AnimInstance->Montage_Stop(0.1f, ChargedAttackMontage);
+			if (UAnimMontage* LoadedComboMontage = ComboAttackMontage.Get())
+			{
+				AnimInstance->Montage_Stop(0.1f, LoadedComboMontage);
+			}
+
+			if (UAnimMontage* LoadedChargedMontage = ChargedAttackMontage.Get())
+			{
+				AnimInstance->Montage_Stop(0.1f, LoadedChargedMontage);
+			}
+		}
+
+		// baked attacks are interrupted the same way
+		if (BakedAttack.IsPlaying())
+		{
+			BakedAttack.Stop(*this);
+			AttackMontageEnded(nullptr, true);
+		}
+
+		// think at full rate while we're being fought
+		if (UAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UAILODSubsystem>())
+		{
+			AILOD->PromoteAI(this);
 		}
 
 		// pass control to BP to play effects, etc.
@@ -220,11 +319,12 @@ void ACombatEnemy::ApplyDamage(float Damage, AActor* DamageCauser, const FVector
 
 void ACombatEnemy::HandleDeath()
 {
-	// hide the life bar
-	LifeBar->SetHiddenInGame(true);
+	// remove the life bar and stop being considered by aim assist and player attacks
+	UnregisterCombatPresence();
 
-	// disable the collision capsule to avoid being hit again while dead
+	// disable the collision capsule and hurtbox to avoid being hit again while dead
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Hurtbox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
 	// disable character movement
 	GetCharacterMovement()->DisableMovement();
@@ -232,6 +332,12 @@ void ACombatEnemy::HandleDeath()
 	// enable full ragdoll physics
 	GetMesh()->SetSimulatePhysics(true);
 
+	// count against the ragdoll budget, which freezes us once we settle or the budget runs out
+	if (URagdollBudgetSubsystem* RagdollBudget = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+	{
+		RagdollBudget->RegisterRagdoll(GetMesh());
+	}
+
 	// call the died delegate to notify any subscribers
 	OnEnemyDied.Broadcast();
 
@@ -246,10 +352,176 @@ void ACombatEnemy::ApplyHealing(float Healing, AActor* Healer)
 
 void ACombatEnemy::RemoveFromLevel()
 {
+	// go back to the pool we were taken from, if it's still around
+	if (OnEnemyReleased.IsBound())
+	{
+		OnEnemyReleased.Execute(this);
+		return;
+	}
+
 	// destroy this actor
 	Destroy();
 }
 
+void ACombatEnemy::ResetForSpawn(const FTransform& SpawnTransform)
+{
+	// clear anything left over from the previous life
+	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
+	ResetAttackState();
+
+	// take the mesh back from the ragdoll and put it back under the capsule
+	if (URagdollBudgetSubsystem* RagdollBudget = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+	{
+		RagdollBudget->UnregisterRagdoll(GetMesh());
+	}
+
+	const ACombatEnemy* Defaults = GetClass()->GetDefaultObject<ACombatEnemy>();
+
+	GetMesh()->SetSimulatePhysics(false);
+	GetMesh()->SetPhysicsBlendWeight(0.0f);
+	GetMesh()->SetCollisionEnabled(Defaults->GetMesh()->GetCollisionEnabled());
+	GetMesh()->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	GetMesh()->SetRelativeLocationAndRotation(GetBaseTranslationOffset(), GetBaseRotationOffset());
+
+	// restore collision before moving, so the spawn spot is adjusted around other characters
+	GetCapsuleComponent()->SetCollisionEnabled(Defaults->GetCapsuleComponent()->GetCollisionEnabled());
+	Hurtbox->SetCollisionEnabled(Defaults->Hurtbox->GetCollisionEnabled());
+	SetActorEnableCollision(true);
+
+	// an encroached spot that can't be adjusted still gets us, same as spawning with AdjustIfPossibleButAlwaysSpawn
+	if (!TeleportTo(SpawnTransform.GetLocation(), SpawnTransform.Rotator()))
+	{
+		SetActorLocationAndRotation(SpawnTransform.GetLocation(), SpawnTransform.GetRotation(), false, nullptr, ETeleportType::TeleportPhysics);
+	}
+
+	// wake back up
+	SetActorHiddenInGame(false);
+	SetActorTickEnabled(true);
+	GetMesh()->SetComponentTickEnabled(true);
+	GetCharacterMovement()->SetComponentTickEnabled(true);
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->SetDefaultMovementMode();
+
+	// top the HP before restarting the StateTree, same as on BeginPlay
+	CurrentHP = MaxHP;
+	RegisterCombatPresence();
+
+	if (UAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UAILODSubsystem>())
+	{
+		AILOD->RegisterAI(this);
+	}
+
+	if (AAIController* AIController = Cast<AAIController>(GetController()))
+	{
+		if (UBrainComponent* Brain = AIController->GetBrainComponent())
+		{
+			Brain->RestartLogic();
+		}
+	}
+}
+
+void ACombatEnemy::DeactivateForPool()
+{
+	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
+
+	// stop thinking and moving first, so interrupting the attack doesn't feed back into the StateTree
+	if (AAIController* AIController = Cast<AAIController>(GetController()))
+	{
+		AIController->StopMovement();
+
+		if (UBrainComponent* Brain = AIController->GetBrainComponent())
+		{
+			Brain->StopLogic(TEXT("Returned to pool"));
+		}
+	}
+
+	ResetAttackState();
+
+	// leave every registry; pre-warmed enemies registered themselves in BeginPlay
+	UnregisterCombatPresence();
+
+	if (UAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UAILODSubsystem>())
+	{
+		AILOD->UnregisterAI(this);
+	}
+
+	if (URagdollBudgetSubsystem* RagdollBudget = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+	{
+		RagdollBudget->UnregisterRagdoll(GetMesh());
+	}
+
+	GetMesh()->SetSimulatePhysics(false);
+	GetCharacterMovement()->DisableMovement();
+
+	// hide and go dormant until the next spawn
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	GetMesh()->SetComponentTickEnabled(false);
+	GetCharacterMovement()->SetComponentTickEnabled(false);
+}
+
+void ACombatEnemy::ResetAttackState()
+{
+	if (BakedAttack.IsPlaying())
+	{
+		BakedAttack.Stop(*this);
+	}
+
+	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->StopAllMontages(0.0f);
+	}
+
+	SwingTrace.End();
+	bIsAttacking = false;
+}
+
+void ACombatEnemy::RegisterCombatPresence()
+{
+	// add a full life bar to the screen space layer
+	if (ULifeBarSubsystem* LifeBars = GetWorld()->GetSubsystem<ULifeBarSubsystem>())
+	{
+		if (LifeBarHandle == INDEX_NONE)
+		{
+			LifeBarHandle = LifeBars->RegisterLifeBar(GetRootComponent(), LifeBarOffset, LifeBarColor);
+		}
+	}
+
+	// make ourselves visible to aim assist
+	if (UAimableRegistrySubsystem* AimableRegistry = GetWorld()->GetSubsystem<UAimableRegistrySubsystem>())
+	{
+		AimableRegistry->RegisterAimable(this);
+	}
+
+	// make our hurtbox visible to player attacks
+	if (UHurtboxRegistrySubsystem* HurtboxRegistry = GetWorld()->GetSubsystem<UHurtboxRegistrySubsystem>())
+	{
+		HurtboxRegistry->RegisterHurtbox(Hurtbox, EHurtboxFaction::Enemy);
+	}
+}
+
+void ACombatEnemy::UnregisterCombatPresence()
+{
+	// remove our life bar
+	if (ULifeBarSubsystem* LifeBars = GetWorld()->GetSubsystem<ULifeBarSubsystem>())
+	{
+		LifeBars->UnregisterLifeBar(LifeBarHandle);
+	}
+
+	// remove ourselves from aim assist
+	if (UAimableRegistrySubsystem* AimableRegistry = GetWorld()->GetSubsystem<UAimableRegistrySubsystem>())
+	{
+		AimableRegistry->UnregisterAimable(this);
+	}
+
+	// remove our hurtbox
+	if (UHurtboxRegistrySubsystem* HurtboxRegistry = GetWorld()->GetSubsystem<UHurtboxRegistrySubsystem>())
+	{
+		HurtboxRegistry->UnregisterHurtbox(Hurtbox);
+	}
+}
+
 float ACombatEnemy::TakeDamage(float Damage, struct FDamageEvent const& DamageEvent, AController* EventInstigator, AActor* DamageCauser)
 {
 	// only process damage if the character is still alive
@@ -270,7 +542,10 @@ float ACombatEnemy::TakeDamage(float Damage, struct FDamageEvent const& DamageEv
 	else
 	{
 		// update the life bar
-		LifeBarWidget->SetLifePercentage(CurrentHP / MaxHP);
+		if (ULifeBarSubsystem* LifeBars = GetWorld()->GetSubsystem<ULifeBarSubsystem>())
+		{
+			LifeBars->SetLifePercentage(LifeBarHandle, CurrentHP / MaxHP);
+		}
 
 		// enable partial ragdoll physics, but keep the pelvis vertical
 		GetMesh()->SetPhysicsBlendWeight(0.5f);
@@ -304,12 +579,34 @@ void ACombatEnemy::BeginPlay()
 	// we top the HP before BeginPlay so StateTree picks it up at the right value
 	Super::BeginPlay();
 
-	// get the life bar widget from the widget comp
-	LifeBarWidget = Cast<UCombatLifeBar>(LifeBar->GetUserWidgetObject());
-	check(LifeBarWidget);
+	// add our life bar and make ourselves visible to aim assist and player attacks
+	RegisterCombatPresence();
+
+	// let our AI tick rate follow our significance
+	if (UAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UAILODSubsystem>())
+	{
+		AILOD->RegisterAI(this);
+	}
+
+	// start loading the attack montages now so the first attack doesn't have to wait on them
+	MontageLoadHandle = VariantAssets::RequestAsyncLoad({ ComboAttackMontage.ToSoftObjectPath(), ChargedAttackMontage.ToSoftObjectPath() });
 
-	// fill the life bar
-	LifeBarWidget->SetLifePercentage(1.0f);
+	// off screen, attacks without a bake still run on their montage, whose notifies and end delegate need it ticking.
+	// Only with both attacks baked can the mesh stop ticking altogether while unseen
+	GetMesh()->VisibilityBasedAnimTickOption = ComboAttackBake && ChargedAttackBake
+		? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered
+		: EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+}
+
+void ACombatEnemy::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// advance the baked attack; when it finishes, end it the same way the montage end delegate would
+	if (BakedAttack.IsPlaying() && !BakedAttack.Advance(DeltaSeconds, *this))
+	{
+		AttackMontageEnded(nullptr, false);
+	}
 }
 
 void ACombatEnemy::EndPlay(EEndPlayReason::Type EndPlayReason)
@@ -319,7 +616,20 @@ void ACombatEnemy::EndPlay(EEndPlayReason::Type EndPlayReason)
 	// clear the death timer
 	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
 
+	// remove our life bar, aim assist entry and hurtbox
+	UnregisterCombatPresence();
 
+	// stop managing our AI tick rate
+	if (UAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UAILODSubsystem>())
+	{
+		AILOD->UnregisterAI(this);
+	}
+
+	// release our ragdoll budget slot
+	if (URagdollBudgetSubsystem* RagdollBudget = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+	{
+		RagdollBudget->UnregisterRagdoll(GetMesh());
+	}
 }
 
 USceneComponent* ACombatEnemy::GetAimPointComponent_Implementation() const
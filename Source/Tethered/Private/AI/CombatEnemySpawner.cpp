@@ -6,6 +6,8 @@
 #include "Components/ArrowComponent.h"
 #include "TimerManager.h"
 #include "AI/CombatEnemy.h"
+#include "Data/VariantAssetBundles.h"
+#include "Subsystems/CombatSpawnSchedulerSubsystem.h"
 
 ACombatEnemySpawner::ACombatEnemySpawner()
 {
@@ -33,8 +35,11 @@ void ACombatEnemySpawner::BeginPlay()
 	// should we spawn an enemy right away?
 	if (bShouldSpawnEnemiesImmediately)
 	{
+		// load the enemy class during the initial delay
+		PrefetchEnemyClass();
+
 		// schedule the first enemy spawn
-		GetWorld()->GetTimerManager().SetTimer(SpawnTimer, this, &ACombatEnemySpawner::SpawnEnemy, InitialSpawnDelay);
+		GetWorld()->GetTimerManager().SetTimer(SpawnTimer, this, &ACombatEnemySpawner::QueueSpawn, InitialSpawnDelay);
 	}
 
 }
@@ -43,28 +48,160 @@ void ACombatEnemySpawner::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
-	// clear the spawn timer
+	// clear the spawn timer and any spawn still waiting in the scheduler
 	GetWorld()->GetTimerManager().ClearTimer(SpawnTimer);
+
+	if (UCombatSpawnSchedulerSubsystem* SpawnScheduler = GetWorld()->GetSubsystem<UCombatSpawnSchedulerSubsystem>())
+	{
+		SpawnScheduler->CancelSpawn(this);
+	}
+
+	// let go of the enemy class
+	EnemyClassHandle.Reset();
+
+	// dormant enemies only exist for us; when the level goes away they go with it
+	if (EndPlayReason == EEndPlayReason::Destroyed)
+	{
+		DestroyPool();
+	}
+
+	EnemyPool.Empty();
+}
+
+void ACombatEnemySpawner::QueueSpawn()
+{
+	// let the scheduler spread the spawn out with everyone else's
+	if (UCombatSpawnSchedulerSubsystem* SpawnScheduler = GetWorld()->GetSubsystem<UCombatSpawnSchedulerSubsystem>())
+	{
+		SpawnScheduler->RequestSpawn(this);
+		return;
+	}
+
+	SpawnEnemy();
 }
 
 void ACombatEnemySpawner::SpawnEnemy()
 {
+	// the class is usually prefetched by now; if it isn't, finish loading it rather than skip the spawn
+	UClass* LoadedEnemyClass = VariantAssets::Resolve(EnemyClass);
+
 	// ensure the enemy class is valid
-	if (IsValid(EnemyClass))
+	if (!IsValid(LoadedEnemyClass))
+	{
+		return;
+	}
+
+	// reuse a dormant enemy, skipping any that were destroyed behind our back
+	ACombatEnemy* SpawnedEnemy = nullptr;
+	while (!SpawnedEnemy && !EnemyPool.IsEmpty())
 	{
-		// spawn the enemy at the reference capsule's transform
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		SpawnedEnemy = EnemyPool.Pop(EAllowShrinking::No);
+		SpawnedEnemy = IsValid(SpawnedEnemy) ? SpawnedEnemy : nullptr;
+	}
+
+	// the pool is empty or wasn't warmed up yet
+	if (!SpawnedEnemy)
+	{
+		SpawnedEnemy = CreatePooledEnemy(LoadedEnemyClass);
+	}
+
+	// bring the enemy to life at the reference capsule's transform
+	if (SpawnedEnemy)
+	{
+		SpawnedEnemy->ResetForSpawn(SpawnCapsule->GetComponentTransform());
+	}
+}
+
+void ACombatEnemySpawner::WarmPool()
+{
+	// let the scheduler spread the pool out over frames left idle by spawns
+	if (UCombatSpawnSchedulerSubsystem* SpawnScheduler = GetWorld()->GetSubsystem<UCombatSpawnSchedulerSubsystem>())
+	{
+		SpawnScheduler->RequestPoolWarmup(this);
+		return;
+	}
 
-		ACombatEnemy* SpawnedEnemy = GetWorld()->SpawnActor<ACombatEnemy>(EnemyClass, SpawnCapsule->GetComponentTransform(), SpawnParams);
+	while (WarmPoolStep())
+	{
+	}
+}
 
-		// was the enemy successfully created?
-		if (SpawnedEnemy)
+bool ACombatEnemySpawner::WarmPoolStep()
+{
+	// only use the class if it's already in memory; this may run from the load completion callback
+	UClass* LoadedEnemyClass = EnemyClass.Get();
+	if (!IsValid(LoadedEnemyClass))
+	{
+		return false;
+	}
+
+	// there's no point keeping more enemies around than we'll ever spawn
+	const int32 TargetSize = FMath::Min(PoolSize, SpawnCount);
+	if (NumPreWarmed >= TargetSize)
+	{
+		return false;
+	}
+
+	ACombatEnemy* PooledEnemy = CreatePooledEnemy(LoadedEnemyClass);
+	if (!PooledEnemy)
+	{
+		return false;
+	}
+
+	EnemyPool.Add(PooledEnemy);
+	++NumPreWarmed;
+
+	return NumPreWarmed < TargetSize;
+}
+
+ACombatEnemy* ACombatEnemySpawner::CreatePooledEnemy(UClass* LoadedEnemyClass)
+{
+	// dormant enemies don't collide, so they can all share the reference capsule's transform
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ACombatEnemy* PooledEnemy = GetWorld()->SpawnActor<ACombatEnemy>(LoadedEnemyClass, SpawnCapsule->GetComponentTransform(), SpawnParams);
+
+	// was the enemy successfully created?
+	if (!PooledEnemy)
+	{
+		return nullptr;
+	}
+
+	// subscribe to the death delegate once for the enemy's whole lifetime, and take it back when its death time is up
+	PooledEnemy->OnEnemyDied.AddDynamic(this, &ACombatEnemySpawner::OnEnemyDied);
+	PooledEnemy->OnEnemyReleased.BindUObject(this, &ACombatEnemySpawner::ReturnEnemyToPool);
+
+	// sleep until spawned
+	PooledEnemy->DeactivateForPool();
+
+	return PooledEnemy;
+}
+
+void ACombatEnemySpawner::DestroyPool()
+{
+	for (ACombatEnemy* PooledEnemy : EnemyPool)
+	{
+		if (IsValid(PooledEnemy))
 		{
-			// subscribe to the death delegate
-			SpawnedEnemy->OnEnemyDied.AddDynamic(this, &ACombatEnemySpawner::OnEnemyDied);
+			PooledEnemy->Destroy();
 		}
 	}
+
+	EnemyPool.Empty();
+}
+
+void ACombatEnemySpawner::ReturnEnemyToPool(ACombatEnemy* Enemy)
+{
+	// once depleted we won't spawn again, so let the enemy go
+	if (SpawnCount <= 0)
+	{
+		Enemy->Destroy();
+		return;
+	}
+
+	Enemy->DeactivateForPool();
+	EnemyPool.Add(Enemy);
 }
 
 void ACombatEnemySpawner::OnEnemyDied()
@@ -81,11 +218,14 @@ void ACombatEnemySpawner::OnEnemyDied()
 	}
 
 	// schedule the next enemy spawn
-	GetWorld()->GetTimerManager().SetTimer(SpawnTimer, this, &ACombatEnemySpawner::SpawnEnemy, RespawnDelay);
+	GetWorld()->GetTimerManager().SetTimer(SpawnTimer, this, &ACombatEnemySpawner::QueueSpawn, RespawnDelay);
 }
 
 void ACombatEnemySpawner::SpawnerDepleted()
 {
+	// we won't spawn again, so pre-warmed enemies that were never used can go
+	DestroyPool();
+
 	// process the actors to activate list
 	for (AActor* CurrentActor : ActorsToActivateWhenDepleted)
 	{
@@ -98,6 +238,21 @@ void ACombatEnemySpawner::SpawnerDepleted()
 	}
 }
 
+void ACombatEnemySpawner::PrefetchEnemyClass()
+{
+	// only request the class once
+	if (!EnemyClassHandle.IsValid())
+	{
+		EnemyClassHandle = VariantAssets::RequestAsyncLoad({ EnemyClass.ToSoftObjectPath() });
+
+		// fill the pool once the class is loaded, or right away if it already was
+		if (!EnemyClassHandle.IsValid() || !EnemyClassHandle->BindCompleteDelegate(FStreamableDelegate::CreateUObject(this, &ACombatEnemySpawner::WarmPool)))
+		{
+			WarmPool();
+		}
+	}
+}
+
 void ACombatEnemySpawner::ToggleInteraction(AActor* ActivationInstigator)
 {
 	// stub
@@ -115,10 +270,19 @@ void ACombatEnemySpawner::ActivateInteraction(AActor* ActivationInstigator)
 	bHasBeenActivated = true;
 
 	// spawn the first enemy
-	SpawnEnemy();
+	QueueSpawn();
 }
 
 void ACombatEnemySpawner::DeactivateInteraction(AActor* ActivationInstigator)
 {
 	// stub
 }
+
+void ACombatEnemySpawner::PrefetchInteraction(AActor* ActivationInstigator)
+{
+	// nothing to prefetch if we've already been activated
+	if (!bHasBeenActivated)
+	{
+		PrefetchEnemyClass();
+	}
+}
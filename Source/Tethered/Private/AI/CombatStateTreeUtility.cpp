@@ -8,7 +8,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AIController.h"
 #include "AI/CombatEnemy.h"
-#include "Kismet/GameplayStatics.h"
+#include "Subsystems/PlayerInfoSubsystem.h"
 #include "StateTreeAsyncExecutionContext.h"
 
 bool FStateTreeCharacterGroundedCondition::TestCondition(FStateTreeExecutionContext& Context) const
@@ -274,18 +274,23 @@ EStateTreeRunStatus FStateTreeGetPlayerInfoTask::Tick(FStateTreeExecutionContext
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	// get the character possessed by the first local player
-	InstanceData.TargetPlayerCharacter = Cast<ACharacter>(UGameplayStatics::GetPlayerPawn(InstanceData.Character, 0));
+	// target the nearest player from this frame's shared snapshot
+	const FVector CharacterLocation = InstanceData.Character->GetActorLocation();
+	UPlayerInfoSubsystem* PlayerInfo = InstanceData.Character->GetWorld()->GetSubsystem<UPlayerInfoSubsystem>();
+	const FPlayerInfo* NearestPlayer = PlayerInfo ? PlayerInfo->FindNearestPlayer(CharacterLocation) : nullptr;
+
+	InstanceData.TargetPlayerCharacter = NearestPlayer ? Cast<ACharacter>(NearestPlayer->Pawn.Get()) : nullptr;
 
 	// do we have a valid target?
 	if (InstanceData.TargetPlayerCharacter)
 	{
-		// update the last known location
-		InstanceData.TargetPlayerLocation = InstanceData.TargetPlayerCharacter->GetActorLocation();
+		// update the last known location and velocity
+		InstanceData.TargetPlayerLocation = NearestPlayer->Location;
+		InstanceData.TargetPlayerVelocity = NearestPlayer->Velocity;
 	}
 
 	// update the distance
-	InstanceData.DistanceToTarget = FVector::Distance(InstanceData.TargetPlayerLocation, InstanceData.Character->GetActorLocation());
+	InstanceData.DistanceToTarget = FVector::Distance(InstanceData.TargetPlayerLocation, CharacterLocation);
 
 	return EStateTreeRunStatus::Running;
 }
@@ -2,16 +2,25 @@
 
 
 #include "AI/EnvQueryContext_Player.h"
-#include "Kismet/GameplayStatics.h"
+#include "Subsystems/PlayerInfoSubsystem.h"
 #include "EnvironmentQuery/EnvQueryTypes.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_Actor.h"
 #include "GameFramework/Pawn.h"
 
 void UEnvQueryContext_Player::ProvideContext(FEnvQueryInstance& QueryInstance, FEnvQueryContextData& ContextData) const
 {
-	// get the player pawn for the first local player
-	AActor* PlayerPawn = UGameplayStatics::GetPlayerPawn(QueryInstance.Owner.Get(), 0);
-	check(PlayerPawn);
+	// get the nearest player pawn from this frame's shared snapshot
+	const AActor* Querier = Cast<AActor>(QueryInstance.Owner.Get());
+	const FVector QuerierLocation = Querier ? Querier->GetActorLocation() : FVector::ZeroVector;
+	UPlayerInfoSubsystem* PlayerInfo = QueryInstance.World ? QueryInstance.World->GetSubsystem<UPlayerInfoSubsystem>() : nullptr;
+	const FPlayerInfo* NearestPlayer = PlayerInfo ? PlayerInfo->FindNearestPlayer(QuerierLocation) : nullptr;
+
+	// no player has a pawn right now, e.g. between death and respawn
+	AActor* PlayerPawn = NearestPlayer ? NearestPlayer->Pawn.Get() : nullptr;
+	if (!PlayerPawn)
+	{
+		return;
+	}
 
 	// add the actor data to the context
 	UEnvQueryItemType_Actor::SetContextHelper(ContextData, PlayerPawn);
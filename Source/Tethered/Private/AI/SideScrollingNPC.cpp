@@ -4,6 +4,7 @@
 #include "AI/SideScrollingNPC.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
+#include "Subsystems/AILODSubsystem.h"
 
 ASideScrollingNPC::ASideScrollingNPC()
 {
@@ -12,12 +13,29 @@ ASideScrollingNPC::ASideScrollingNPC()
 	GetCharacterMovement()->MaxWalkSpeed = 150.0f;
 }
 
+void ASideScrollingNPC::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// let our AI tick rate follow our significance
+	if (UAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UAILODSubsystem>())
+	{
+		AILOD->RegisterAI(this);
+	}
+}
+
 void ASideScrollingNPC::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
 	// clear the deactivation timer
 	GetWorld()->GetTimerManager().ClearTimer(DeactivationTimer);
+
+	// stop managing our AI tick rate
+	if (UAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UAILODSubsystem>())
+	{
+		AILOD->UnregisterAI(this);
+	}
 }
 
 void ASideScrollingNPC::Interaction(AActor* Interactor)
@@ -34,6 +52,12 @@ void ASideScrollingNPC::Interaction(AActor* Interactor)
 	// stop character movement immediately
 	GetCharacterMovement()->StopMovementImmediately();
 
+	// react at full rate once we're back on our feet
+	if (UAILODSubsystem* AILOD = GetWorld()->GetSubsystem<UAILODSubsystem>())
+	{
+		AILOD->PromoteAI(this);
+	}
+
 	// launch the NPC away from the interactor
 	FVector LaunchVector = Interactor->GetActorForwardVector() * LaunchImpulse;
 	LaunchVector.Y = 0.0f;
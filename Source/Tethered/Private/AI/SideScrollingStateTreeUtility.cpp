@@ -5,22 +5,27 @@
 #include "StateTreeExecutionContext.h"
 #include "StateTreeExecutionTypes.h"
 #include "AIController.h"
-#include "Kismet/GameplayStatics.h"
+#include "Subsystems/PlayerInfoSubsystem.h"
 
 EStateTreeRunStatus FStateTreeGetPlayerTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
 {
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	// set the player pawn as the target
-	InstanceData.TargetPlayer = UGameplayStatics::GetPlayerPawn(InstanceData.Controller.Get(), 0);
-
-	// are the NPC and target valid?
-	if (IsValid(InstanceData.TargetPlayer) && IsValid(InstanceData.NPC))
+	// is the NPC valid?
+	if (!IsValid(InstanceData.NPC))
 	{
-		InstanceData.bValidTarget = FVector::Distance(InstanceData.NPC->GetActorLocation(), InstanceData.TargetPlayer->GetActorLocation()) < InstanceData.RangeMax;
+		return EStateTreeRunStatus::Running;
 	}
 
+	// set the nearest player pawn from this frame's shared snapshot as the target
+	float Distance = 0.0f;
+	UPlayerInfoSubsystem* PlayerInfo = InstanceData.NPC->GetWorld()->GetSubsystem<UPlayerInfoSubsystem>();
+	const FPlayerInfo* NearestPlayer = PlayerInfo ? PlayerInfo->FindNearestPlayer(InstanceData.NPC->GetActorLocation(), &Distance) : nullptr;
+
+	InstanceData.TargetPlayer = NearestPlayer ? NearestPlayer->Pawn.Get() : nullptr;
+	InstanceData.bValidTarget = InstanceData.TargetPlayer && Distance < InstanceData.RangeMax;
+
 	return EStateTreeRunStatus::Running;
 }
 
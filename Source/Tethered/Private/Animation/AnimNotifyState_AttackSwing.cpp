@@ -0,0 +1,37 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Animation/AnimNotifyState_AttackSwing.h"
+#include "Interfaces/CombatAttacker.h"
+#include "Components/SkeletalMeshComponent.h"
+
+void UAnimNotifyState_AttackSwing::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	// cast the owner to the attacker interface
+	if (ICombatAttacker* AttackerInterface = Cast<ICombatAttacker>(MeshComp->GetOwner()))
+	{
+		AttackerInterface->BeginAttackSwing(AttackBoneName);
+	}
+}
+
+void UAnimNotifyState_AttackSwing::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
+{
+	if (ICombatAttacker* AttackerInterface = Cast<ICombatAttacker>(MeshComp->GetOwner()))
+	{
+		AttackerInterface->TickAttackSwing();
+	}
+}
+
+void UAnimNotifyState_AttackSwing::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	if (ICombatAttacker* AttackerInterface = Cast<ICombatAttacker>(MeshComp->GetOwner()))
+	{
+		// sweep the last stretch of the swing before closing it
+		AttackerInterface->TickAttackSwing();
+		AttackerInterface->EndAttackSwing();
+	}
+}
+
+FString UAnimNotifyState_AttackSwing::GetNotifyName_Implementation() const
+{
+	return FString("Attack Swing");
+}
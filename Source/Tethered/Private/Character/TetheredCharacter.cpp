@@ -18,6 +18,8 @@
 #include "Components/PlayerMovementComponent.h"
 #include "Components/AimAssistComponent.h"
 #include "Data/AimAssistProfile.h"
+#include "Gameplay/CombatCollision.h"
+#include "Subsystems/HurtboxRegistrySubsystem.h"
 
 
 DEFINE_LOG_CATEGORY(LogTetheredCharacter);
@@ -50,6 +52,14 @@ ATetheredCharacter::ATetheredCharacter()
 	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
 	FollowCamera->bUsePawnControlRotation = false;
 
+	// Create the hurtbox on the player faction channel, only enemy attacks see it
+	Hurtbox = CreateDefaultSubobject<UCapsuleComponent>(TEXT("Hurtbox"));
+	Hurtbox->SetupAttachment(RootComponent);
+	Hurtbox->InitCapsuleSize(35.0f, 90.0f);
+	Hurtbox->SetCollisionProfileName(CombatCollision::PlayerHurtboxProfile);
+	Hurtbox->SetGenerateOverlapEvents(false);
+	Hurtbox->SetCanEverAffectNavigation(false);
+
 	// Create the life bar widget component
 	LifeBar = CreateDefaultSubobject<UWidgetComponent>(TEXT("LifeBar"));
 	LifeBar->SetupAttachment(RootComponent);
@@ -96,11 +106,22 @@ void ATetheredCharacter::BeginPlay()
 	{
 		AimAssistComponent->SetActiveProfile(DefaultAimAssistProfile);
 	}
+
+	// Make the hurtbox visible to enemy attacks
+	if (UHurtboxRegistrySubsystem* HurtboxRegistry = GetWorld()->GetSubsystem<UHurtboxRegistrySubsystem>())
+	{
+		HurtboxRegistry->RegisterHurtbox(Hurtbox, EHurtboxFaction::Player);
+	}
 }
 
 void ATetheredCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
+
+	if (UHurtboxRegistrySubsystem* HurtboxRegistry = GetWorld()->GetSubsystem<UHurtboxRegistrySubsystem>())
+	{
+		HurtboxRegistry->UnregisterHurtbox(Hurtbox);
+	}
 }
 
 void ATetheredCharacter::Tick(float DeltaTime)
@@ -349,6 +370,30 @@ void ATetheredCharacter::DoAttackTrace(FName DamageSourceBone)
 	}
 }
 
+void ATetheredCharacter::BeginAttackSwing(FName DamageSourceBone)
+{
+	if (CombatComponent)
+	{
+		CombatComponent->BeginAttackSwing(DamageSourceBone);
+	}
+}
+
+void ATetheredCharacter::TickAttackSwing()
+{
+	if (CombatComponent)
+	{
+		CombatComponent->TickAttackSwing();
+	}
+}
+
+void ATetheredCharacter::EndAttackSwing()
+{
+	if (CombatComponent)
+	{
+		CombatComponent->EndAttackSwing();
+	}
+}
+
 void ATetheredCharacter::CheckCombo()
 {
 	if (CombatComponent)
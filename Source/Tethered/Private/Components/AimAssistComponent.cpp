@@ -1,17 +1,43 @@
 // AimAssistComponent.cpp
 #include "Components/AimAssistComponent.h"
 #include "Interfaces/Aimable.h"
+#include "Interfaces/InterfaceDispatchCache.h"
+#include "Subsystems/DebugDrawSubsystem.h"
+#include "Subsystems/AimAssistSolverSubsystem.h"
+#include "Components/AimAssistStats.h"
+#include "Tasks/Task.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerController.h"
-#include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Engine/Canvas.h"
 #include "Engine/Engine.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogAimAssist, Log, All);
 
+// Query pipeline stats, declared in AimAssistStats.h
+DEFINE_STAT(STAT_AimAssist_Query);
+DEFINE_STAT(STAT_AimAssist_SolverGather);
+DEFINE_STAT(STAT_AimAssist_Select);
+DEFINE_STAT(STAT_AimAssist_StageScore);
+DEFINE_STAT(STAT_AimAssist_StageFilter);
+DEFINE_STAT(STAT_AimAssist_StageTopK);
+DEFINE_STAT(STAT_AimAssist_StageLOS);
+DEFINE_STAT(STAT_AimAssist_Resolve);
+DEFINE_STAT(STAT_AimAssist_PlayersQueried);
+DEFINE_STAT(STAT_AimAssist_Candidates);
+DEFINE_STAT(STAT_AimAssist_RejectedRange);
+DEFINE_STAT(STAT_AimAssist_RejectedFOV);
+DEFINE_STAT(STAT_AimAssist_RejectedTargetable);
+DEFINE_STAT(STAT_AimAssist_RejectedTopK);
+DEFINE_STAT(STAT_AimAssist_RejectedLOS);
+DEFINE_STAT(STAT_AimAssist_LOSTraces);
+DEFINE_STAT(STAT_AimAssist_LOSShared);
+DEFINE_STAT(STAT_AimAssist_LOSGrid);
+DEFINE_STAT(STAT_AimAssist_QueryRate);
+
 // Global debug state - Definition of the static member variable
 bool UAimAssistComponent::bGlobalDebugEnabled = false;
 
@@ -51,41 +77,104 @@ void UAimAssistComponent::BeginPlay()
 		UE_LOG(LogAimAssist, Error, TEXT("NO PROFILE SET!"));
 	}
 	
-	UE_LOG(LogAimAssist, Warning, TEXT("Query Interval: %.3f"), QueryInterval);
-	UE_LOG(LogAimAssist, Warning, TEXT("ObjectTypes Count: %d"), ObjectTypes.Num());
+	UE_LOG(LogAimAssist, Warning, TEXT("Query Interval: %.3f (idle %.3f)"), QueryInterval, IdleQueryInterval);
 	
-	for (int32 i = 0; i < ObjectTypes.Num(); ++i)
-	{
-		UE_LOG(LogAimAssist, Warning, TEXT("  ObjectType[%d]: %d"), i, (int32)ObjectTypes[i]);
-	}
+	// Queries are scheduled from tick; run the first one as soon as we can
+	bForceQuery = true;
+	TimeSinceQuery = 0.f;
 	
-	if (QueryInterval > 0.f)
+	if (UAimAssistSolverSubsystem* Solver = GetWorld()->GetSubsystem<UAimAssistSolverSubsystem>())
 	{
-		GetWorld()->GetTimerManager().SetTimer(
-			QueryTimer, this, &UAimAssistComponent::QueryForTarget,
-			QueryInterval, true, 0.05f);
-		UE_LOG(LogAimAssist, Warning, TEXT("Timer started successfully"));
+		Solver->RegisterPlayer(this);
 	}
 	else
 	{
-		UE_LOG(LogAimAssist, Error, TEXT("Query interval is 0 or negative! Timer not started!"));
+		UE_LOG(LogAimAssist, Error, TEXT("NO AIM ASSIST SOLVER! Queries will not run."));
+	}
+	
+	if (bRecordDecisions)
+	{
+		StartDecisionRecording();
 	}
 	
 	UE_LOG(LogAimAssist, Warning, TEXT("=== BeginPlay Complete ==="));
 }
 
-/** Clean up timer when component is destroyed */
+/** Drop any pending query state when component is destroyed */
 void UAimAssistComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	GetWorld()->GetTimerManager().ClearTimer(QueryTimer);
+	if (UAimAssistSolverSubsystem* Solver = GetWorld()->GetSubsystem<UAimAssistSolverSubsystem>())
+	{
+		Solver->UnregisterPlayer(this);
+	}
+	
+	// A task still in flight keeps its own reference and finishes harmlessly
+	PendingSelection.Reset();
+	PendingLineOfSight.Reset();
+	PendingLineOfSightCount = 0;
+	
+	// Don't lose a capture that was still running
+	if (Recorder.IsRecording())
+	{
+		StopDecisionRecording();
+	}
+	
 	Super::EndPlay(EndPlayReason);
 }
 
+/** Starts capturing query decisions into the ring */
+void UAimAssistComponent::StartDecisionRecording()
+{
+	Recorder.Start(DecisionRecordCapacity, ScoreWeights);
+	UE_LOG(LogAimAssist, Log, TEXT("Decision recording started (%d queries)"), DecisionRecordCapacity);
+}
+
+/** Stops capturing and writes the ring to disk */
+FString UAimAssistComponent::StopDecisionRecording()
+{
+	if (!Recorder.IsRecording())
+	{
+		return FString();
+	}
+	
+	Recorder.Stop();
+	
+	const FString Dir = FPaths::ProjectSavedDir() / TEXT("AimAssist");
+	IFileManager::Get().MakeDirectory(*Dir, true);
+	
+	const FString Filename = Dir / FString::Printf(TEXT("AimAssist_%s.aarec"), *FDateTime::Now().ToString());
+	if (!Recorder.SaveToFile(Filename))
+	{
+		UE_LOG(LogAimAssist, Error, TEXT("Failed to write decision capture to %s"), *Filename);
+		return FString();
+	}
+	
+	UE_LOG(LogAimAssist, Log, TEXT("Decision capture written to %s"), *Filename);
+	return Filename;
+}
+
 /** Main tick function - applies aim assist if target exists */
 void UAimAssistComponent::TickComponent(float Dt, ELevelTick, FActorComponentTickFunction*)
 {
 	if (!Profile || !OwnerChar.IsValid()) return;
 	
+	UpdateQueryRate(Dt);
+	
+	// Pick up the selection task launched by the solver on an earlier frame
+	if (PendingSelection.IsValid() && PendingSelection->IsPublished())
+	{
+		ConsumeSelection();
+	}
+	
+	if (ShouldQuery(Dt))
+	{
+		// The solver runs every player's due query against one shared snapshot at the end of the frame
+		if (UAimAssistSolverSubsystem* Solver = GetWorld()->GetSubsystem<UAimAssistSolverSubsystem>())
+		{
+			Solver->RequestQuery(this);
+		}
+	}
+	
 	if (CurrentTarget.IsValid())
 	{
 		ApplyAssist(Dt);
@@ -98,6 +187,71 @@ void UAimAssistComponent::TickComponent(float Dt, ELevelTick, FActorComponentTic
 	}
 }
 
+/** Decides whether a query is due this frame */
+bool UAimAssistComponent::ShouldQuery(float Dt)
+{
+	TimeSinceQuery += Dt;
+
+	// One selection task at a time; it is consumed on a following tick
+	if (PendingSelection.IsValid())
+	{
+		return false;
+	}
+
+	if (bForceQuery)
+	{
+		return true;
+	}
+
+	// The current target died or despawned, so drop it and pick a new one right away.
+	// Dead aimables unregister themselves, so registry membership doubles as a liveness check
+	if (!CurrentTarget.IsExplicitlyNull())
+	{
+		const AActor* Curr = CurrentTarget.Get();
+		const UAimableRegistrySubsystem* AimableRegistry = GetWorld()->GetSubsystem<UAimableRegistrySubsystem>();
+		if (!Curr || (AimableRegistry && !AimableRegistry->IsRegistered(Curr)))
+		{
+			CurrentTarget.Reset();
+			return true;
+		}
+	}
+
+	// Don't cut an LOS batch short for motion triggers; it lands next frame
+	if (PendingLineOfSightCount > 0)
+	{
+		return false;
+	}
+
+	// Large turn or displacement since the last query invalidates the candidate set
+	const float YawDelta = FMath::Abs(FMath::FindDeltaAngleDegrees(LastQueryYaw, OwnerChar->GetActorRotation().Yaw));
+	if (YawDelta >= RequeryYawThresholdDeg)
+	{
+		return true;
+	}
+
+	if (FVector::DistSquared2D(LastQueryLocation, GetPlayerPos()) >= FMath::Square(RequeryDistanceThresholdCm))
+	{
+		return true;
+	}
+
+	// Otherwise run on a cadence: fast while anything is moving, slow when the scene is still
+	const bool bPlayerMoving = OwnerChar->GetVelocity().SizeSquared2D() > FMath::Square(IdleSpeedThreshold);
+	const float Interval = (bPlayerMoving || bCandidatesMoving) ? QueryInterval : FMath::Max(QueryInterval, IdleQueryInterval);
+	return TimeSinceQuery >= Interval;
+}
+
+/** Updates the rolling effective query rate */
+void UAimAssistComponent::UpdateQueryRate(float Dt)
+{
+	QueryRateWindow += Dt;
+	if (QueryRateWindow >= 1.f)
+	{
+		EffectiveQueryRate = QueriesInWindow / QueryRateWindow;
+		QueriesInWindow = 0;
+		QueryRateWindow = 0.f;
+	}
+}
+
 /** Gets the player character's world position */
 FVector UAimAssistComponent::GetPlayerPos() const
 {
@@ -125,26 +279,13 @@ USceneComponent* UAimAssistComponent::GetAimPointComp(AActor* Target) const
 {
 	if (!Target) return nullptr;
 	
-	// Try to use the interface directly first (more efficient)
-	if (IAimable* AimableTarget = Cast<IAimable>(Target))
+	// Per-class cached dispatch handles both native and Blueprint implementations
+	if (USceneComponent* AimPoint = FInterfaceDispatchCache::GetAimPointComponent(Target))
 	{
-		// Use the interface method directly
-		USceneComponent* AimPoint = AimableTarget->Execute_GetAimPointComponent(Target);
-		if (AimPoint) return AimPoint;
+		return AimPoint;
 	}
 	
-	// Fallback to reflection method if direct interface call fails
-	if (Target->GetClass()->ImplementsInterface(UAimable::StaticClass()))
-	{
-		if (UFunction* Fn = Target->FindFunction(TEXT("GetAimPointComponent")))
-		{
-			USceneComponent* Out = nullptr;
-			Target->ProcessEvent(Fn, &Out);
-			if (Out) return Out;
-		}
-	}
-	
-	// Final fallback to root component
+	// Fallback to root component
 	return Target->GetRootComponent();
 }
 
@@ -155,51 +296,24 @@ FVector UAimAssistComponent::GetAimPointWorld(AActor* Target) const
 	return Target ? Target->GetActorLocation() : FVector::ZeroVector;
 }
 
-/** Checks if target direction is within the FOV cone */
-bool UAimAssistComponent::PassesFOV2D(const FVector& ToTarget2D) const
+/** Reports the area this player needs candidates from, for the solver's shared gather */
+bool UAimAssistComponent::GetQueryBounds(FVector& OutOrigin, float& OutRange) const
 {
-	if (!Profile) return false;
-	const FVector2D CharacterForward = GetTargetingDirection2D();
-	const FVector2D To = FVector2D(ToTarget2D.X, ToTarget2D.Y).GetSafeNormal();
-	const float dot = FVector2D::DotProduct(CharacterForward, To);
-	const float minCos = FMath::Cos(FMath::DegreesToRadians(Profile->QueryFOVDeg));
-	return dot >= minCos;
-}
+	if (!Profile || !OwnerChar.IsValid())
+	{
+		return false;
+	}
 
-/** Performs line trace to check clear line of sight to target */
-bool UAimAssistComponent::HasLineOfSightToAimPoint(AActor* Target) const
-{
-	if (!OwnerChar.IsValid() || !Target) return false;
-	const FVector From = GetPlayerPos() + FVector(0, 0, 50);
-	const FVector To = GetAimPointWorld(Target);
-	FHitResult Hit;
-	FCollisionQueryParams P(SCENE_QUERY_STAT(AimAssist_LOS), false, GetOwner());
-	const bool bHit = GetWorld()->LineTraceSingleByChannel(Hit, From, To, LOSChannel, P);
-	return (!bHit) || (Hit.GetActor() == Target);
+	OutOrigin = GetPlayerPos();
+	OutRange = Profile->GetCompiled().RangeCm;
+	return true;
 }
 
-/** Calculates priority score for target selection based on multiple factors */
-float UAimAssistComponent::ScoreTarget(AActor* Target, float Dist2D, float Dot2D, bool bIsCurrent) const
+/** Captures this player's query inputs and launches target selection as a task against the solver's snapshot */
+void UAimAssistComponent::QueryForTarget(UAimAssistSolverSubsystem& Solver)
 {
-	FVector Vel = FVector::ZeroVector;
-	if (const UPrimitiveComponent* Prim = Cast<UPrimitiveComponent>(Target->GetRootComponent()))
-		Vel = Prim->GetComponentVelocity();
-	const FVector2D V2(Vel.X, Vel.Y);
-	const FVector2D CharacterForward = GetTargetingDirection2D();
-	const float VelAlign = V2.IsNearlyZero() ? 0.f : FVector2D::DotProduct(V2.GetSafeNormal(), CharacterForward);
-
-	const float distTerm = (Dist2D > KINDA_SMALL_NUMBER) ? (1.f / Dist2D) : 1.f;
-	const float sticky = bIsCurrent ? 1.f : 0.f;
+	SCOPE_CYCLE_COUNTER(STAT_AimAssist_Query);
 
-	return WDist * distTerm + WAngle * Dot2D + WVel * VelAlign + WSticky * sticky;
-}
-
-/** Searches for and selects the best target within range */
-void UAimAssistComponent::QueryForTarget()
-{
-	// Always log entry for debugging
-	UE_LOG(LogAimAssist, Warning, TEXT("=== QueryForTarget Called ==="));
-	
 	if (!Profile)
 	{
 		UE_LOG(LogAimAssist, Error, TEXT("QueryForTarget: NO PROFILE! Exiting early."));
@@ -212,205 +326,242 @@ void UAimAssistComponent::QueryForTarget()
 		return;
 	}
 
-	const FVector Center = GetPlayerPos();
-	TArray<AActor*> Ignore; Ignore.Add(GetOwner());
-	TArray<AActor*> Hits;
-
-	// Always log search parameters
-	UE_LOG(LogAimAssist, Warning, TEXT("Search Parameters:"));
-	UE_LOG(LogAimAssist, Warning, TEXT("  Center: %s"), *Center.ToString());
-	UE_LOG(LogAimAssist, Warning, TEXT("  Range: %.1f"), Profile->AssistRangeCm);
-	UE_LOG(LogAimAssist, Warning, TEXT("  ObjectTypes Count: %d"), ObjectTypes.Num());
-
-	// TEMPORARY: Try searching with AActor::StaticClass() to bypass collision issues
-	UKismetSystemLibrary::SphereOverlapActors(
-		this, Center, Profile->AssistRangeCm,
-		ObjectTypes, AActor::StaticClass(), Ignore, Hits);
-
-	// Always log results
-	UE_LOG(LogAimAssist, Warning, TEXT("SphereOverlapActors Result: Found %d actors"), Hits.Num());
-	
-	if (Hits.Num() == 0)
-	{
-		UE_LOG(LogAimAssist, Error, TEXT("NO ACTORS FOUND! Possible issues:"));
-		UE_LOG(LogAimAssist, Error, TEXT("1. No actors in range"));
-		UE_LOG(LogAimAssist, Error, TEXT("2. ObjectTypes mismatch (current count: %d)"), ObjectTypes.Num());
-		UE_LOG(LogAimAssist, Error, TEXT("3. Range too small: %.1f"), Profile->AssistRangeCm);
-		UE_LOG(LogAimAssist, Error, TEXT("4. Actors don't have proper collision setup"));
-		CurrentTarget = nullptr;
+	const TSharedPtr<const FAimAssistSnapshot, ESPMode::ThreadSafe>& Snapshot = Solver.GetSnapshot();
+	if (!Snapshot.IsValid())
+	{
 		return;
 	}
 
-	// Log all found actors
-	for (int32 i = 0; i < Hits.Num(); ++i)
+	const FVector Center = GetPlayerPos();
+
+	// Record the pose this query ran from, for the motion triggers
+	bForceQuery = false;
+	TimeSinceQuery = 0.f;
+	LastQueryLocation = Center;
+	LastQueryYaw = OwnerChar->GetActorRotation().Yaw;
+	QueriesInWindow++;
+
+	// Any LOS results still in flight from the previous query are now stale
+	PendingLineOfSight.Reset();
+	PendingLineOfSightCount = 0;
+	QuerySerial++;
+
+	// Everything the selection needs is copied by value; the task never touches the component or any actor
+	FAimAssistSelectionParams Params;
+	Params.Origin = FVector2f(Center.X, Center.Y);
+	Params.Forward = FVector2f(GetTargetingDirection2D());
+	const FAimAssistCompiledProfile& Compiled = Profile->GetCompiled();
+	Params.RangeCm = Compiled.RangeCm;
+	Params.MinFOVCos = Compiled.CosQueryFOV;
+	Params.IdleSpeedSq = FMath::Square(IdleSpeedThreshold);
+	Params.MaxLineOfSightCandidates = MaxLineOfSightCandidates;
+	Params.Weights = ScoreWeights;
+	Params.Owner = GetOwner();
+	Params.CurrentTarget = CurrentTarget.Get();
+
+	// The result is picked up by TickComponent once the task has published it
+	PendingSelection = MakeShared<FAimAssistSelectionJob, ESPMode::ThreadSafe>(Snapshot.ToSharedRef(), Params);
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Job = PendingSelection]() { Job->Run(); });
+}
+
+/** Applies a published selection result: fills debug and capture data and queues LOS checks for the survivors */
+void UAimAssistComponent::ConsumeSelection()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AimAssist_StageLOS);
+
+	const TSharedPtr<FAimAssistSelectionJob, ESPMode::ThreadSafe> Job = MoveTemp(PendingSelection);
+	const FAimAssistSnapshot& Snapshot = *Job->Snapshot;
+	const FAimAssistSelectionResult& Result = Job->Result;
+
+	bCandidatesMoving = Result.bCandidatesMoving;
+
+	// Debug arrays hold every candidate that made it to the LOS stage or was cut by top-K
+	DebugPotentialTargets.Reset();
+	DebugTargetScores.Reset();
+	DebugTargetHasLOS.Reset();
+	for (const FAimAssistSelectedCandidate& Candidate : Result.InRange)
+	{
+		if (Candidate.Stage == EAimAssistRecordedStage::Selectable || Candidate.Stage == EAimAssistRecordedStage::RejectedTopK)
+		{
+			DebugPotentialTargets.Add(Snapshot.Actors[Candidate.SnapshotIndex].Get());
+			DebugTargetScores.Add(Candidate.Score);
+		}
+	}
+
+	// Optional decision capture; opening a record drops any query that never resolved
+	if (Recorder.IsRecording())
 	{
-		AActor* Actor = Hits[i];
-		if (Actor)
+		FAimAssistRecordedQuery& Record = Recorder.BeginQuery();
+		Record.Time = Snapshot.Time;
+		Record.Origin = Job->Params.Origin;
+		Record.Forward = Job->Params.Forward;
+		Record.MinFOVCos = Job->Params.MinFOVCos;
+		Record.Stickiness = Profile ? Profile->GetCompiled().Stickiness : 0.f;
+		Record.MaxLineOfSightCandidates = Job->Params.MaxLineOfSightCandidates;
+		Record.PreviousTargetId = Recorder.GetActorId(CurrentTarget.Get());
+		Record.QueryMs = Result.SelectMs;
+
+		// Record slots line up with InRange, so LOS outcomes can be written back by index
+		for (const FAimAssistSelectedCandidate& Candidate : Result.InRange)
 		{
-			bool bImplementsAimable = Actor->GetClass()->ImplementsInterface(UAimable::StaticClass());
-			UE_LOG(LogAimAssist, Warning, TEXT("  [%d] Actor: %s (Class: %s) - Aimable: %s"), 
-				i, *Actor->GetName(), *Actor->GetClass()->GetName(),
-				bImplementsAimable ? TEXT("YES") : TEXT("NO"));
+			const int32 i = Candidate.SnapshotIndex;
+			FAimAssistRecordedCandidate& Recorded = Record.Candidates.AddDefaulted_GetRef();
+			Recorded.ActorId = Recorder.GetActorId(Snapshot.Actors[i].Get());
+			Recorded.Position = FVector2f(Snapshot.Inputs.PosX[i], Snapshot.Inputs.PosY[i]);
+			Recorded.Velocity = FVector2f(Snapshot.Inputs.VelX[i], Snapshot.Inputs.VelY[i]);
+			Recorded.Score = Candidate.Score;
+			Recorded.Stage = Candidate.Stage;
 		}
-		else
+	}
+
+	UAimAssistSolverSubsystem* Solver = GetWorld()->GetSubsystem<UAimAssistSolverSubsystem>();
+
+	// All LOS checks for this query share the origin it was launched from
+	const FVector TraceFrom = LastQueryLocation + FVector(0, 0, 50);
+
+	for (const int32 InRangeIndex : Result.LineOfSight)
+	{
+		const FAimAssistSelectedCandidate& Candidate = Result.InRange[InRangeIndex];
+
+		FPendingLineOfSight& Pending = PendingLineOfSight.AddDefaulted_GetRef();
+		Pending.Target = Snapshot.Actors[Candidate.SnapshotIndex];
+		Pending.Score = Candidate.Score;
+		Pending.RecordSlot = InRangeIndex;
+
+		// Candidates destroyed since the snapshot simply fail LOS
+		AActor* Target = Pending.Target.Get();
+		if (!Target || !Solver)
 		{
-			UE_LOG(LogAimAssist, Warning, TEXT("  [%d] NULL ACTOR"), i);
+			continue;
 		}
+
+		// The solver may already have a result for these endpoints; otherwise it lands next frame in OnSharedLineOfSight
+		const EAimAssistLineOfSight LineOfSight = Solver->RequestLineOfSight(TraceFrom, Target, Snapshot.AimPoints[Candidate.SnapshotIndex], LOSChannel,
+			this, PendingLineOfSight.Num() - 1, QuerySerial);
+
+		Pending.bWaiting = LineOfSight == EAimAssistLineOfSight::Pending;
+		Pending.bHasLOS = LineOfSight == EAimAssistLineOfSight::Visible;
+		PendingLineOfSightCount += Pending.bWaiting ? 1 : 0;
 	}
 
-	AActor* Best = nullptr;
-	float BestScore = -FLT_MAX;
+	UE_LOG(LogAimAssist, Verbose, TEXT("Query: %d in snapshot, %d in range, %d LOS checks (%d waiting), selected in %.3f ms"),
+		Snapshot.Num(), Result.InRange.Num(), PendingLineOfSight.Num(), PendingLineOfSightCount, Result.SelectMs);
 
-	// Clear debug arrays
-	DebugPotentialTargets.Empty();
-	DebugTargetScores.Empty();
+	// Every LOS result was already known, so we can pick the target right away
+	if (PendingLineOfSightCount == 0)
+	{
+		ResolveTargetFromLineOfSight();
+	}
+}
 
-	// Score the current target too, for hysteresis comparison
-	float CurrentScore = -FLT_MAX;
-	AActor* Curr = CurrentTarget.Get();
-	if (Curr)
+/** Collects one shared LOS result and selects the target once the whole batch has landed */
+void UAimAssistComponent::OnSharedLineOfSight(int32 RequestIndex, uint32 InQuerySerial, bool bHasLOS)
+{
+	// Ignore results from a batch that was superseded by a newer query
+	if (InQuerySerial != QuerySerial || !PendingLineOfSight.IsValidIndex(RequestIndex) || !PendingLineOfSight[RequestIndex].bWaiting)
 	{
-		UE_LOG(LogAimAssist, Warning, TEXT("Current target exists: %s"), *Curr->GetName());
-		const FVector To = GetAimPointWorld(Curr) - Center;
-		const FVector To2D = FVector(To.X, To.Y, 0.f);
-		const float Dist2D = To2D.Size();
-		const FVector2D CharacterForward = GetTargetingDirection2D();
-		const float Dot2D = FVector2D::DotProduct(CharacterForward, FVector2D(To2D.X, To2D.Y).GetSafeNormal());
-		if (PassesFOV2D(To2D) && HasLineOfSightToAimPoint(Curr))
-			CurrentScore = ScoreTarget(Curr, Dist2D, Dot2D, true);
+		return;
 	}
-	else
+
+	FPendingLineOfSight& Pending = PendingLineOfSight[RequestIndex];
+	Pending.bWaiting = false;
+	Pending.bHasLOS = bHasLOS;
+
+	if (--PendingLineOfSightCount == 0)
 	{
-		UE_LOG(LogAimAssist, Warning, TEXT("No current target"));
+		ResolveTargetFromLineOfSight();
 	}
+}
 
-	int32 ValidTargets = 0;
-	int32 TargetsInFOV = 0;
+/** Picks the best LOS-cleared candidate from the pending batch and applies hysteresis */
+void UAimAssistComponent::ResolveTargetFromLineOfSight()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AimAssist_Resolve);
+
+	AActor* Curr = CurrentTarget.Get();
+	AActor* Best = nullptr;
+	float BestScore = -FLT_MAX;
+
+	// Score the current target too, for hysteresis comparison
+	float CurrentScore = -FLT_MAX;
 	int32 TargetsWithLOS = 0;
-	int32 ProcessedActors = 0;
 
-	// Evaluate all potential targets
-	for (AActor* A : Hits)
+	for (const FPendingLineOfSight& Pending : PendingLineOfSight)
 	{
-		ProcessedActors++;
-		UE_LOG(LogAimAssist, Warning, TEXT("Processing actor %d: %s"), ProcessedActors, A ? *A->GetName() : TEXT("NULL"));
-		
-		if (!A || A == GetOwner()) 
+		AActor* A = Pending.Target.Get();
+		if (!A || !Pending.bHasLOS)
 		{
-			UE_LOG(LogAimAssist, Warning, TEXT("  Skipping: NULL or owner"));
-			continue;
-		}
-		
-		// Check if it implements IAimable interface
-		bool bImplementsInterface = A->GetClass()->ImplementsInterface(UAimable::StaticClass());
-		UE_LOG(LogAimAssist, Warning, TEXT("  Implements IAimable: %s"), bImplementsInterface ? TEXT("YES") : TEXT("NO"));
-		
-		if (!bImplementsInterface) 
-		{
-			UE_LOG(LogAimAssist, Warning, TEXT("  Skipping: Doesn't implement IAimable"));
 			continue;
 		}
+		TargetsWithLOS++;
 
-		// Check if target can be targeted using the IAimable interface
-		bool bCanBeTargeted = true;
-		if (IAimable* AimableTarget = Cast<IAimable>(A))
-		{
-			bCanBeTargeted = AimableTarget->Execute_CanBeTargeted(A);
-			UE_LOG(LogAimAssist, Warning, TEXT("  Direct interface call - CanBeTargeted: %s"), bCanBeTargeted ? TEXT("YES") : TEXT("NO"));
-		}
-		else
-		{
-			// Fallback to reflection method if direct cast fails
-			if (UFunction* Fn = A->FindFunction(TEXT("CanBeTargeted")))
-			{
-				A->ProcessEvent(Fn, &bCanBeTargeted);
-				UE_LOG(LogAimAssist, Warning, TEXT("  Reflection call - CanBeTargeted: %s"), bCanBeTargeted ? TEXT("YES") : TEXT("NO"));
-			}
-			else
-			{
-				UE_LOG(LogAimAssist, Warning, TEXT("  No CanBeTargeted function found, assuming true"));
-			}
-		}
-		
-		if (!bCanBeTargeted) 
+		if (A == Curr)
 		{
-			UE_LOG(LogAimAssist, Warning, TEXT("  Skipping: CanBeTargeted returned false"));
-			continue;
+			CurrentScore = Pending.Score;
 		}
-		ValidTargets++;
 
-		const FVector To = GetAimPointWorld(A) - Center;
-		const FVector To2D = FVector(To.X, To.Y, 0.f);
-		const float Dist2D = To2D.Size();
-		
-		UE_LOG(LogAimAssist, Warning, TEXT("  Distance: %.1f"), Dist2D);
-		
-		if (Dist2D <= KINDA_SMALL_NUMBER) 
+		if (Pending.Score > BestScore)
 		{
-			UE_LOG(LogAimAssist, Warning, TEXT("  Skipping: Too close (distance <= %f)"), KINDA_SMALL_NUMBER);
-			continue;
+			BestScore = Pending.Score;
+			Best = A;
 		}
+	}
 
-		const FVector2D CharacterForward = GetTargetingDirection2D();
-		const float Dot2D = FVector2D::DotProduct(CharacterForward, FVector2D(To2D.X, To2D.Y).GetSafeNormal());
-		const float S = ScoreTarget(A, Dist2D, Dot2D, A == Curr);
-
-		// Store for debug visualization
-		DebugPotentialTargets.Add(A);
-		DebugTargetScores.Add(S);
-
-		// Check FOV and LOS
-		bool bInFOV = PassesFOV2D(To2D);
-		bool bHasLOS = HasLineOfSightToAimPoint(A);
-		
-		if (bInFOV) TargetsInFOV++;
-		if (bHasLOS) TargetsWithLOS++;
+	// Cache LOS per debug target so visualization doesn't need its own traces
+	DebugTargetHasLOS.Init(false, DebugPotentialTargets.Num());
+	for (int32 i = 0; i < DebugPotentialTargets.Num(); ++i)
+	{
+		DebugTargetHasLOS[i] = PendingLineOfSight.ContainsByPredicate([Target = DebugPotentialTargets[i]](const FPendingLineOfSight& Pending)
+			{
+				return Pending.bHasLOS && Pending.Target.Get() == Target;
+			});
+	}
 
-		UE_LOG(LogAimAssist, Warning, TEXT("  InFOV: %s, HasLOS: %s, Score: %.2f"), 
-			bInFOV ? TEXT("YES") : TEXT("NO"), bHasLOS ? TEXT("YES") : TEXT("NO"), S);
+	INC_DWORD_STAT_BY(STAT_AimAssist_RejectedLOS, PendingLineOfSight.Num() - TargetsWithLOS);
 
-		// Only consider targets that pass FOV and LOS checks for actual targeting
-		if (bInFOV && bHasLOS)
+	// Record LOS outcomes; the choice itself is filled in after hysteresis
+	FAimAssistRecordedQuery* Record = Recorder.GetOpenQuery();
+	if (Record)
+	{
+		for (const FPendingLineOfSight& Pending : PendingLineOfSight)
 		{
-			if (S > BestScore) 
-			{ 
-				BestScore = S; 
-				Best = A; 
-				UE_LOG(LogAimAssist, Warning, TEXT("  NEW BEST TARGET: %s (Score: %.2f)"), *A->GetName(), S);
+			if (!Pending.bHasLOS && Record->Candidates.IsValidIndex(Pending.RecordSlot))
+			{
+				Record->Candidates[Pending.RecordSlot].Stage = EAimAssistRecordedStage::RejectedLOS;
 			}
 		}
-		else
-		{
-			UE_LOG(LogAimAssist, Warning, TEXT("  Failed FOV or LOS check"));
-		}
 	}
 
-	// Always log the final summary
-	UE_LOG(LogAimAssist, Warning, TEXT("=== FINAL RESULTS ==="));
-	UE_LOG(LogAimAssist, Warning, TEXT("Processed: %d, Valid: %d, InFOV: %d, WithLOS: %d"), 
-		ProcessedActors, ValidTargets, TargetsInFOV, TargetsWithLOS);
-	UE_LOG(LogAimAssist, Warning, TEXT("Selected Target: %s"), Best ? *Best->GetName() : TEXT("NONE"));
+	UE_LOG(LogAimAssist, Verbose, TEXT("Resolve: %d traced, %d with LOS, selected %s"),
+		PendingLineOfSight.Num(), TargetsWithLOS, Best ? *Best->GetName() : TEXT("NONE"));
 
 	// Hysteresis: require new target to beat current by a margin (prevents jittering)
-	if (Best && Curr && Best != Curr)
+	if (Best && Curr && Best != Curr && CurrentScore > -FLT_MAX)
 	{
-		const float margin = FMath::Lerp(0.f, 0.25f, Profile->Stickiness); // up to +25% better required
-		if (BestScore < CurrentScore * (1.f + margin))
+		// Same rule as AimAssistScoring::ShouldKeepCurrentTarget, with the multiplier precompiled from stickiness
+		const float HysteresisMultiplier = Profile ? Profile->GetCompiled().HysteresisMultiplier : 1.f;
+		if (BestScore < CurrentScore * HysteresisMultiplier)
 		{
 			Best = Curr; // keep current
-			UE_LOG(LogAimAssist, Warning, TEXT("Hysteresis: Keeping current target due to margin"));
+			UE_LOG(LogAimAssist, Verbose, TEXT("Hysteresis: Keeping current target due to margin"));
 		}
 	}
 	
 	CurrentTarget = Best;
-	UE_LOG(LogAimAssist, Warning, TEXT("=== QueryForTarget Complete ==="));
+	PendingLineOfSight.Reset();
+
+	if (Record)
+	{
+		Record->ChosenTargetId = Recorder.GetActorId(Best);
+		Recorder.CommitQuery();
+	}
 }
 
-/** Returns assist strength based on input magnitude - stronger with lighter input */
+/** Returns assist strength based on input magnitude from the profile's stick curve - stronger with lighter input by default */
 float UAimAssistComponent::AssistStrengthByStick() const
 {
-	const float t = FMath::Clamp(AimInputMagnitude, 0.f, 1.f);
-	return FMath::Lerp(1.f, 0.25f, t); // strong assist at low input, weak at high
+	if (!Profile) return 0.f;
+	return FAimAssistCompiledProfile::Sample(Profile->GetCompiled().StickStrengthLUT, AimInputMagnitude);
 }
 
 /** Rotates character toward target by specified degrees with proper direction */
@@ -432,25 +583,32 @@ void UAimAssistComponent::ApplyAssist(float Dt)
 {
 	if (!Profile || !CurrentTarget.IsValid()) return;
 
+	const FAimAssistCompiledProfile& Compiled = Profile->GetCompiled();
+
 	const FVector P = GetPlayerPos();
 	FVector To = GetAimPointWorld(CurrentTarget.Get()) - P; To.Z = 0.f;
+	const float Dist = To.Size2D();
 	FVector2D To2D(To.X, To.Y); To2D.Normalize();
 
 	const FVector2D CharacterForward = GetTargetingDirection2D();
-	const float Angle = Angle2D(CharacterForward, To2D);
+	const float Dot = FMath::Clamp(FVector2D::DotProduct(CharacterForward, To2D), -1.f, 1.f);
+	const float Angle = FMath::RadiansToDegrees(FMath::Acos(Dot));
 
 	// Note: Magnetism (bending aim vector) is removed since we use character forward direction only
 	// Friction should be implemented in camera/look code by reading the current target state
 
 	// (1) Soft snap (controller/touch onlygate by your input mode)
 	const bool bAllowSnap = true;
-	if (bAllowSnap && Angle <= Profile->SnapConeDeg)
+	if (bAllowSnap && Dot >= Compiled.CosSnapCone)
 	{
-		ApplyYawToward(To2D, FMath::Min(Angle, Profile->MaxSnapDeg));
+		ApplyYawToward(To2D, FMath::Min(Angle, Compiled.MaxSnapDeg));
 	}
 
-	// (2) Rotational assist - turn character toward target
-	const float MaxStep = Profile->MaxYawDegPerSec * Dt * AssistStrengthByStick();
+	// (2) Rotational assist - turn character toward target, shaped by the profile's stick, distance and angle curves
+	const float Strength = FAimAssistCompiledProfile::Sample(Compiled.StickStrengthLUT, AimInputMagnitude)
+		* FAimAssistCompiledProfile::Sample(Compiled.DistanceFalloffLUT, Dist * Compiled.InvRangeCm)
+		* FAimAssistCompiledProfile::Sample(Compiled.AngleFalloffLUT, Angle * (1.f / 180.f));
+	const float MaxStep = Compiled.MaxYawDegPerSec * Dt * Strength;
 	if (MaxStep > 0.f && Angle > 0.01f)
 	{
 		ApplyYawToward(To2D, FMath::Min(Angle, MaxStep));
@@ -518,29 +676,32 @@ void UAimAssistComponent::DrawDebugInfo()
 {
 	if (!Profile || !OwnerChar.IsValid() || !GetWorld()) return;
 
-	DrawDetectionRange();
-	DrawFOVCone();
-	DrawAssistCones();
-	DrawLineOfSightTraces();
-	DrawTargetInfo();
+	// Everything is queued on the retained debug layer and submitted in one batch at the end of the frame
+	UDebugDrawSubsystem* DebugDraw = GetWorld()->GetSubsystem<UDebugDrawSubsystem>();
+	if (!DebugDraw) return;
+
+	DrawDetectionRange(*DebugDraw);
+	DrawFOVCone(*DebugDraw);
+	DrawAssistCones(*DebugDraw);
+	DrawLineOfSightTraces(*DebugDraw);
+	DrawTargetInfo(*DebugDraw);
 }
 
 /** Draws the detection range sphere */
-void UAimAssistComponent::DrawDetectionRange()
+void UAimAssistComponent::DrawDetectionRange(UDebugDrawSubsystem& DebugDraw)
 {
 	const FVector Center = GetPlayerPos();
 	const float Radius = Profile->AssistRangeCm;
 	
-	// Draw detection sphere (wireframe)
-	DrawDebugSphere(GetWorld(), Center, Radius, 128, FColor::Blue, false, -1.f, 0, 0.5f);
+	// Cached unit sphere, only the transform changes
+	DebugDraw.AddShape(UDebugDrawSubsystem::SphereShape(64), FTransform(FQuat::Identity, Center, FVector(Radius)), FColor::Blue, 0.5f);
 	
 	// Draw range text
-	DrawDebugString(GetWorld(), Center + FVector(0, 0, Radius + 50), 
-		FString::Printf(TEXT("Range: %.0fcm"), Radius), nullptr, FColor::Blue, 0.f);
+	DebugDraw.AddText(Center + FVector(0, 0, Radius + 50), FString::Printf(TEXT("Range: %.0fcm"), Radius), FColor::Blue);
 }
 
 /** Draws the FOV cone */
-void UAimAssistComponent::DrawFOVCone()
+void UAimAssistComponent::DrawFOVCone(UDebugDrawSubsystem& DebugDraw)
 {
 	const FVector Center = GetPlayerPos();
 	const FVector2D CharacterForward = GetTargetingDirection2D();
@@ -549,38 +710,17 @@ void UAimAssistComponent::DrawFOVCone()
 	const float FOVAngle = Profile->QueryFOVDeg;
 	const float ConeLength = Profile->AssistRangeCm * 0.8f; // Slightly shorter than detection range
 	
-	// Draw FOV cone edges
-	const float HalfAngleRad = FMath::DegreesToRadians(FOVAngle * 0.5f);
-	
-	// Calculate cone edge directions
-	const FVector RightEdge = CharacterForward3D.RotateAngleAxis(FOVAngle * 0.5f, FVector::UpVector);
-	const FVector LeftEdge = CharacterForward3D.RotateAngleAxis(-FOVAngle * 0.5f, FVector::UpVector);
-	
-	// Draw cone lines
-	DrawDebugLine(GetWorld(), Center, Center + RightEdge * ConeLength, FColor::Green, false, -1.f, 0, 1.f);
-	DrawDebugLine(GetWorld(), Center, Center + LeftEdge * ConeLength, FColor::Green, false, -1.f, 0, 1.f);
-	DrawDebugLine(GetWorld(), Center, Center + CharacterForward3D * ConeLength, FColor::Green, false, -1.f, 0, 2.f);
-	
-	// Draw FOV arc
-	const int32 NumSegments = 16;
-	for (int32 i = 0; i < NumSegments; ++i)
-	{
-		const float Angle1 = -FOVAngle * 0.5f + (FOVAngle * i / NumSegments);
-		const float Angle2 = -FOVAngle * 0.5f + (FOVAngle * (i + 1) / NumSegments);
-		
-		const FVector Dir1 = CharacterForward3D.RotateAngleAxis(Angle1, FVector::UpVector);
-		const FVector Dir2 = CharacterForward3D.RotateAngleAxis(Angle2, FVector::UpVector);
-		
-		DrawDebugLine(GetWorld(), Center + Dir1 * ConeLength, Center + Dir2 * ConeLength, FColor::Green, false, -1.f, 0, 1.f);
-	}
+	// Cached arc with edges, rotated to the character forward and scaled to the cone length
+	const FTransform ConeTransform(CharacterForward3D.ToOrientationQuat(), Center, FVector(ConeLength));
+	DebugDraw.AddShape(UDebugDrawSubsystem::ArcShape(FOVAngle, 16), ConeTransform, FColor::Green, 1.f);
 	
 	// Draw FOV text
-	DrawDebugString(GetWorld(), Center + CharacterForward3D * (ConeLength + 100), 
-		FString::Printf(TEXT("FOV: %.1f (Character Forward)"), FOVAngle), nullptr, FColor::Green, 0.f);
+	DebugDraw.AddText(Center + CharacterForward3D * (ConeLength + 100), 
+		FString::Printf(TEXT("FOV: %.1f (Character Forward)"), FOVAngle), FColor::Green);
 }
 
 /** Draws assist cones (friction, snap) */
-void UAimAssistComponent::DrawAssistCones()
+void UAimAssistComponent::DrawAssistCones(UDebugDrawSubsystem& DebugDraw)
 {
 	if (!CurrentTarget.IsValid()) return;
 	
@@ -589,67 +729,66 @@ void UAimAssistComponent::DrawAssistCones()
 	const FVector ToTarget = (TargetPos - Center).GetSafeNormal();
 	const FVector2D CharacterForward = GetTargetingDirection2D();
 	const FVector CharacterForward3D = FVector(CharacterForward.X, CharacterForward.Y, 0).GetSafeNormal();
+	const FQuat ForwardRotation = CharacterForward3D.ToOrientationQuat();
 	
 	const float ConeLength = FVector::Dist(Center, TargetPos) * 0.7f;
 	
 	// Draw friction cone (Orange) - for camera/look system reference
 	const float FrictionAngle = Profile->FrictionConeDeg;
-	DrawDebugCone(GetWorld(), Center, CharacterForward3D, ConeLength * 0.8f, 
-		FMath::DegreesToRadians(FrictionAngle * 0.5f), 
-		FMath::DegreesToRadians(FrictionAngle * 0.5f), 8, FColor::Orange, false, -1.f, 0, 1.f);
+	DebugDraw.AddShape(UDebugDrawSubsystem::ConeShape(FrictionAngle * 0.5f, 8), 
+		FTransform(ForwardRotation, Center, FVector(ConeLength * 0.8f)), FColor::Orange, 1.f);
 	
 	// Draw snap cone (Red)
 	const float SnapAngle = Profile->SnapConeDeg;
-	DrawDebugCone(GetWorld(), Center, CharacterForward3D, ConeLength * 0.6f, 
-		FMath::DegreesToRadians(SnapAngle * 0.5f), 
-		FMath::DegreesToRadians(SnapAngle * 0.5f), 6, FColor::Red, false, -1.f, 0, 2.f);
+	DebugDraw.AddShape(UDebugDrawSubsystem::ConeShape(SnapAngle * 0.5f, 6), 
+		FTransform(ForwardRotation, Center, FVector(ConeLength * 0.6f)), FColor::Red, 2.f);
 	
 	// Draw assist info (removed magnetism since it's not used)
 	const FVector InfoPos = Center + FVector(0, 0, 100);
-	DrawDebugString(GetWorld(), InfoPos, 
+	DebugDraw.AddText(InfoPos, 
 		FString::Printf(TEXT("Friction: %.1f | Snap: %.1f"), 
-			FrictionAngle, SnapAngle), nullptr, FColor::Yellow, 0.f);
+			FrictionAngle, SnapAngle), FColor::Yellow);
 	
 	// Show current angle to target
 	const FVector2D ToTarget2D = FVector2D(ToTarget.X, ToTarget.Y).GetSafeNormal();
 	const float AngleToTarget = Angle2D(CharacterForward, ToTarget2D);
-	DrawDebugString(GetWorld(), InfoPos + FVector(0, 0, 30), 
-		FString::Printf(TEXT("Angle to Target: %.1f (Char Forward)"), AngleToTarget), nullptr, FColor::White, 0.f);
+	DebugDraw.AddText(InfoPos + FVector(0, 0, 30), 
+		FString::Printf(TEXT("Angle to Target: %.1f (Char Forward)"), AngleToTarget), FColor::White);
 }
 
-/** Draws line of sight traces to targets */
-void UAimAssistComponent::DrawLineOfSightTraces()
+/** Draws line of sight results from the last resolved query */
+void UAimAssistComponent::DrawLineOfSightTraces(UDebugDrawSubsystem& DebugDraw)
 {
 	const FVector Center = GetPlayerPos() + FVector(0, 0, 50);
 	
-	// Draw LOS to current target
+	// Draw LOS to current target - it only gets selected with a clear LOS
 	if (CurrentTarget.IsValid())
 	{
 		const FVector TargetPos = GetAimPointWorld(CurrentTarget.Get());
-		const bool bHasLOS = HasLineOfSightToAimPoint(CurrentTarget.Get());
-		const FColor LOSColor = bHasLOS ? FColor::Green : FColor::Red;
+		const FColor LOSColor = FColor::Green;
 		
-		DrawDebugLine(GetWorld(), Center, TargetPos, LOSColor, false, -1.f, 0, 3.f);
-		DrawDebugSphere(GetWorld(), TargetPos, 25.f, 8, LOSColor, false, -1.f, 0, 2.f);
+		DebugDraw.AddLine(Center, TargetPos, LOSColor, 3.f);
+		DebugDraw.AddShape(UDebugDrawSubsystem::SphereShape(8), FTransform(FQuat::Identity, TargetPos, FVector(25.f)), LOSColor, 2.f);
 	}
 	
-	// Draw LOS to other potential targets
-	for (AActor* Target : DebugPotentialTargets)
+	// Draw LOS to other potential targets (candidates outside the FOV are never traced and draw as blocked)
+	for (int32 i = 0; i < DebugPotentialTargets.Num(); ++i)
 	{
+		AActor* Target = DebugPotentialTargets[i];
 		if (Target && Target != CurrentTarget.Get())
 		{
 			const FVector TargetPos = GetAimPointWorld(Target);
-			const bool bHasLOS = HasLineOfSightToAimPoint(Target);
+			const bool bHasLOS = DebugTargetHasLOS.IsValidIndex(i) && DebugTargetHasLOS[i];
 			const FColor LOSColor = bHasLOS ? FColor::Green : FColor::Red;
 			
-			DrawDebugLine(GetWorld(), Center, TargetPos, LOSColor, false, -1.f, 0, 1.f);
-			DrawDebugSphere(GetWorld(), TargetPos, 15.f, 6, LOSColor, false, -1.f, 0, 1.f);
+			DebugDraw.AddLine(Center, TargetPos, LOSColor, 1.f);
+			DebugDraw.AddShape(UDebugDrawSubsystem::SphereShape(6), FTransform(FQuat::Identity, TargetPos, FVector(15.f)), LOSColor, 1.f);
 		}
 	}
 }
 
 /** Draws target information and scores */
-void UAimAssistComponent::DrawTargetInfo()
+void UAimAssistComponent::DrawTargetInfo(UDebugDrawSubsystem& DebugDraw)
 {
 	// Draw current target info
 	if (CurrentTarget.IsValid())
@@ -657,8 +796,8 @@ void UAimAssistComponent::DrawTargetInfo()
 		const FVector TargetPos = GetAimPointWorld(CurrentTarget.Get());
 		const FString TargetName = CurrentTarget->GetName();
 		
-		DrawDebugString(GetWorld(), TargetPos + FVector(0, 0, 100), 
-			FString::Printf(TEXT("CURRENT TARGET: %s"), *TargetName), nullptr, FColor::Green, 0.f, true);
+		DebugDraw.AddText(TargetPos + FVector(0, 0, 100), 
+			FString::Printf(TEXT("CURRENT TARGET: %s"), *TargetName), FColor::Green);
 	}
 	
 	// Draw scores for all potential targets
@@ -672,18 +811,18 @@ void UAimAssistComponent::DrawTargetInfo()
 		const bool bIsCurrentTarget = Target == CurrentTarget.Get();
 		const FColor ScoreColor = bIsCurrentTarget ? FColor::Green : FColor::Yellow;
 		
-		DrawDebugString(GetWorld(), TargetPos + FVector(0, 0, 50), 
-			FString::Printf(TEXT("Score: %.2f"), Score), nullptr, ScoreColor, 0.f, true);
+		DebugDraw.AddText(TargetPos + FVector(0, 0, 50), 
+			FString::Printf(TEXT("Score: %.2f"), Score), ScoreColor);
 		
 		// Draw target name
-		DrawDebugString(GetWorld(), TargetPos + FVector(0, 0, 75), 
-			Target->GetName(), nullptr, ScoreColor, 0.f, true);
+		DebugDraw.AddText(TargetPos + FVector(0, 0, 75), 
+			Target->GetName(), ScoreColor);
 	}
 	
 	// Draw input magnitude and assist strength
 	const FVector PlayerPos = GetPlayerPos();
-	DrawDebugString(GetWorld(), PlayerPos + FVector(0, 0, 150), 
-		FString::Printf(TEXT("Input Mag: %.2f | Assist Strength: %.2f"), 
-			AimInputMagnitude, AssistStrengthByStick()), nullptr, FColor::Cyan, 0.f, true);
+	DebugDraw.AddText(PlayerPos + FVector(0, 0, 150), 
+		FString::Printf(TEXT("Input Mag: %.2f | Assist Strength: %.2f | Queries: %.1f Hz"), 
+			AimInputMagnitude, AssistStrengthByStick(), EffectiveQueryRate), FColor::Cyan);
 }
 #pragma endregion Debug Visualization
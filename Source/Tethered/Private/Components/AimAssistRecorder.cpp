@@ -0,0 +1,147 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/AimAssistRecorder.h"
+#include "GameFramework/Actor.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+FArchive& operator<<(FArchive& Ar, FAimAssistRecordedCandidate& Candidate)
+{
+	uint8 Stage = static_cast<uint8>(Candidate.Stage);
+	Ar << Candidate.ActorId << Candidate.Position << Candidate.Velocity << Candidate.Score << Stage;
+	Candidate.Stage = static_cast<EAimAssistRecordedStage>(Stage);
+	return Ar;
+}
+
+FArchive& operator<<(FArchive& Ar, FAimAssistRecordedQuery& Query)
+{
+	Ar << Query.Time << Query.Origin << Query.Forward;
+	Ar << Query.MinFOVCos << Query.Stickiness << Query.MaxLineOfSightCandidates;
+	Ar << Query.PreviousTargetId << Query.ChosenTargetId << Query.QueryMs;
+	Ar << Query.Candidates;
+	return Ar;
+}
+
+void FAimAssistRecorder::Start(int32 InCapacity, const FAimAssistScoreWeights& InWeights)
+{
+	Capacity = FMath::Max(1, InCapacity);
+	Weights = InWeights;
+	Ring.Reset(Capacity);
+	Head = 0;
+	ActorIds.Reset();
+	NextActorId = 1;
+	bQueryOpen = false;
+	bRecording = true;
+}
+
+void FAimAssistRecorder::Stop()
+{
+	bRecording = false;
+	bQueryOpen = false;
+}
+
+FAimAssistRecordedQuery& FAimAssistRecorder::BeginQuery()
+{
+	// reuse the open record's candidate allocation
+	OpenQuery.Candidates.Reset();
+	bQueryOpen = true;
+	return OpenQuery;
+}
+
+void FAimAssistRecorder::CommitQuery()
+{
+	if (!bQueryOpen)
+	{
+		return;
+	}
+
+	if (Ring.Num() < Capacity)
+	{
+		Ring.Add(OpenQuery);
+	}
+	else
+	{
+		// overwrite the oldest query
+		Ring[Head] = OpenQuery;
+	}
+
+	Head = (Head + 1) % Capacity;
+	bQueryOpen = false;
+}
+
+bool FAimAssistRecorder::SaveToFile(const FString& Filename) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	FAimAssistScoreWeights SavedWeights = Weights;
+	int32 NumQueries = Ring.Num();
+	Writer << Magic << Version;
+	Writer << SavedWeights.WDist << SavedWeights.WAngle << SavedWeights.WVel << SavedWeights.WSticky;
+	Writer << NumQueries;
+
+	// unroll the ring so the file is oldest first
+	const int32 Oldest = Ring.Num() < Capacity ? 0 : Head;
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		FAimAssistRecordedQuery Query = Ring[(Oldest + i) % Ring.Num()];
+		Writer << Query;
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
+
+bool FAimAssistRecorder::LoadFromFile(const FString& Filename, FAimAssistCapture& OutCapture)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != FileMagic || Version != FileVersion)
+	{
+		return false;
+	}
+
+	int32 NumQueries = 0;
+	Reader << OutCapture.Weights.WDist << OutCapture.Weights.WAngle << OutCapture.Weights.WVel << OutCapture.Weights.WSticky;
+	Reader << NumQueries;
+	if (Reader.IsError() || NumQueries < 0)
+	{
+		return false;
+	}
+
+	OutCapture.Queries.SetNum(NumQueries);
+	for (FAimAssistRecordedQuery& Query : OutCapture.Queries)
+	{
+		Reader << Query;
+	}
+
+	return !Reader.IsError();
+}
+
+uint32 FAimAssistRecorder::GetActorId(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return 0;
+	}
+
+	// GetUniqueID is an object array index the engine hands out again after GC, so it can't identify an actor
+	// across a capture
+	if (const uint32* Id = ActorIds.Find(Actor))
+	{
+		return *Id;
+	}
+
+	return ActorIds.Add(Actor, NextActorId++);
+}
@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/AimAssistScoring.h"
+#include "Math/VectorRegister.h"
+
+void FAimAssistCandidateSoA::Reset(int32 ExpectedNum)
+{
+	PosX.Reset(ExpectedNum);
+	PosY.Reset(ExpectedNum);
+	VelX.Reset(ExpectedNum);
+	VelY.Reset(ExpectedNum);
+	Sticky.Reset(ExpectedNum);
+	Dist2D.Reset(ExpectedNum);
+	Dot2D.Reset(ExpectedNum);
+	Score.Reset(ExpectedNum);
+}
+
+void FAimAssistCandidateSoA::Add(const FVector& AimPoint, const FVector& Velocity, bool bIsCurrent)
+{
+	PosX.Add(static_cast<float>(AimPoint.X));
+	PosY.Add(static_cast<float>(AimPoint.Y));
+	VelX.Add(static_cast<float>(Velocity.X));
+	VelY.Add(static_cast<float>(Velocity.Y));
+	Sticky.Add(bIsCurrent ? 1.f : 0.f);
+}
+
+namespace AimAssistScoring
+{
+	/** Scores a single candidate. Shared by the scalar path and the SIMD remainder */
+	static void ScoreOne(FAimAssistCandidateSoA& C, int32 i, const FVector2f& Origin, const FVector2f& Forward, const FAimAssistScoreWeights& W)
+	{
+		const float DX = C.PosX[i] - Origin.X;
+		const float DY = C.PosY[i] - Origin.Y;
+		const float Dist = FMath::Sqrt(DX * DX + DY * DY);
+		const bool bHasDist = Dist > KINDA_SMALL_NUMBER;
+
+		// facing term uses the normalized direction; zero when the candidate sits on top of us
+		const float Dot = bHasDist ? (DX * Forward.X + DY * Forward.Y) / Dist : 0.f;
+		const float DistTerm = bHasDist ? 1.f / Dist : 1.f;
+
+		// velocity alignment with our forward, zero for stationary candidates
+		const float VelLenSq = C.VelX[i] * C.VelX[i] + C.VelY[i] * C.VelY[i];
+		const float VelAlign = VelLenSq > SMALL_NUMBER ? (C.VelX[i] * Forward.X + C.VelY[i] * Forward.Y) / FMath::Sqrt(VelLenSq) : 0.f;
+
+		C.Dist2D[i] = Dist;
+		C.Dot2D[i] = Dot;
+		C.Score[i] = W.WDist * DistTerm + W.WAngle * Dot + W.WVel * VelAlign + W.WSticky * C.Sticky[i];
+	}
+
+	void ScoreCandidates(FAimAssistCandidateSoA& C, const FVector2f& Origin, const FVector2f& Forward, const FAimAssistScoreWeights& W)
+	{
+		const int32 Num = C.Num();
+		C.Dist2D.SetNumUninitialized(Num, EAllowShrinking::No);
+		C.Dot2D.SetNumUninitialized(Num, EAllowShrinking::No);
+		C.Score.SetNumUninitialized(Num, EAllowShrinking::No);
+
+		// per-query constants, splatted once
+		const VectorRegister4Float OriginX = VectorSetFloat1(Origin.X);
+		const VectorRegister4Float OriginY = VectorSetFloat1(Origin.Y);
+		const VectorRegister4Float ForwardX = VectorSetFloat1(Forward.X);
+		const VectorRegister4Float ForwardY = VectorSetFloat1(Forward.Y);
+		const VectorRegister4Float WDist = VectorSetFloat1(W.WDist);
+		const VectorRegister4Float WAngle = VectorSetFloat1(W.WAngle);
+		const VectorRegister4Float WVel = VectorSetFloat1(W.WVel);
+		const VectorRegister4Float WSticky = VectorSetFloat1(W.WSticky);
+		const VectorRegister4Float DistEpsilon = VectorSetFloat1(KINDA_SMALL_NUMBER);
+		const VectorRegister4Float VelEpsilon = VectorSetFloat1(SMALL_NUMBER);
+		const VectorRegister4Float One = VectorOneFloat();
+		const VectorRegister4Float Zero = VectorZeroFloat();
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			// distance and facing
+			const VectorRegister4Float DX = VectorSubtract(VectorLoad(&C.PosX[i]), OriginX);
+			const VectorRegister4Float DY = VectorSubtract(VectorLoad(&C.PosY[i]), OriginY);
+			const VectorRegister4Float Dist = VectorSqrt(VectorMultiplyAdd(DX, DX, VectorMultiply(DY, DY)));
+			const VectorRegister4Float HasDist = VectorCompareGT(Dist, DistEpsilon);
+			const VectorRegister4Float InvDist = VectorDivide(One, VectorSelect(HasDist, Dist, One));
+
+			const VectorRegister4Float FacingDot = VectorMultiplyAdd(DX, ForwardX, VectorMultiply(DY, ForwardY));
+			const VectorRegister4Float Dot = VectorSelect(HasDist, VectorMultiply(FacingDot, InvDist), Zero);
+
+			// velocity alignment
+			const VectorRegister4Float VX = VectorLoad(&C.VelX[i]);
+			const VectorRegister4Float VY = VectorLoad(&C.VelY[i]);
+			const VectorRegister4Float VelLenSq = VectorMultiplyAdd(VX, VX, VectorMultiply(VY, VY));
+			const VectorRegister4Float HasVel = VectorCompareGT(VelLenSq, VelEpsilon);
+			const VectorRegister4Float VelDot = VectorMultiplyAdd(VX, ForwardX, VectorMultiply(VY, ForwardY));
+			const VectorRegister4Float VelAlign = VectorSelect(HasVel, VectorDivide(VelDot, VectorSqrt(VectorSelect(HasVel, VelLenSq, One))), Zero);
+
+			// weighted sum; InvDist already falls back to 1 for zero distance
+			VectorRegister4Float Score = VectorMultiply(WDist, InvDist);
+			Score = VectorMultiplyAdd(WAngle, Dot, Score);
+			Score = VectorMultiplyAdd(WVel, VelAlign, Score);
+			Score = VectorMultiplyAdd(WSticky, VectorLoad(&C.Sticky[i]), Score);
+
+			VectorStore(Dist, &C.Dist2D[i]);
+			VectorStore(Dot, &C.Dot2D[i]);
+			VectorStore(Score, &C.Score[i]);
+		}
+
+		// remainder that doesn't fill a full register
+		for (; i < Num; ++i)
+		{
+			ScoreOne(C, i, Origin, Forward, W);
+		}
+	}
+
+	void ScoreCandidatesScalar(FAimAssistCandidateSoA& C, const FVector2f& Origin, const FVector2f& Forward, const FAimAssistScoreWeights& W)
+	{
+		const int32 Num = C.Num();
+		C.Dist2D.SetNumUninitialized(Num, EAllowShrinking::No);
+		C.Dot2D.SetNumUninitialized(Num, EAllowShrinking::No);
+		C.Score.SetNumUninitialized(Num, EAllowShrinking::No);
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			ScoreOne(C, i, Origin, Forward, W);
+		}
+	}
+
+	float GetHysteresisMultiplier(float Stickiness)
+	{
+		// the challenger must beat the current target by up to +25%, scaled by stickiness
+		return 1.f + FMath::Lerp(0.f, 0.25f, Stickiness);
+	}
+
+	bool ShouldKeepCurrentTarget(float BestScore, float CurrentScore, float Stickiness)
+	{
+		return BestScore < CurrentScore * GetHysteresisMultiplier(Stickiness);
+	}
+}
@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/AimAssistSelection.h"
+#include "Components/AimAssistStats.h"
+#include "HAL/PlatformTime.h"
+
+void FAimAssistSelectionJob::Run()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AimAssist_Select);
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	const FAimAssistSnapshot& Snap = *Snapshot;
+	const int32 Num = Snap.Num();
+
+	// score every candidate for this player in one vectorized pass; only the sticky flag differs between players
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AimAssist_StageScore);
+
+		Scoring = Snap.Inputs;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Scoring.Sticky[i] = Snap.ActorKeys[i] == Params.CurrentTarget ? 1.f : 0.f;
+		}
+		AimAssistScoring::ScoreCandidates(Scoring, Params.Origin, Params.Forward, Params.Weights);
+	}
+
+	int32 RejectedRange = 0;
+	int32 RejectedFOV = 0;
+	int32 RejectedTargetable = 0;
+	int32 RejectedTopK = 0;
+
+	// range, FOV and targetability only read the kernel outputs and the snapshot
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AimAssist_StageFilter);
+
+		Result.InRange.Reset(Num);
+		Result.bCandidatesMoving = false;
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			// the shared snapshot covers every player, so cull to our own assist radius
+			if (Snap.ActorKeys[i] == Params.Owner || Scoring.Dist2D[i] > Params.RangeCm)
+			{
+				RejectedRange++;
+				continue;
+			}
+
+			const float VelSq = FMath::Square(Scoring.VelX[i]) + FMath::Square(Scoring.VelY[i]);
+			Result.bCandidatesMoving |= VelSq > Params.IdleSpeedSq;
+
+			FAimAssistSelectedCandidate& Candidate = Result.InRange.AddDefaulted_GetRef();
+			Candidate.SnapshotIndex = i;
+			Candidate.Score = Scoring.Score[i];
+
+			if (Scoring.Dist2D[i] <= KINDA_SMALL_NUMBER)
+			{
+				Candidate.Stage = EAimAssistRecordedStage::RejectedRange;
+				RejectedRange++;
+			}
+			else if (Scoring.Dot2D[i] < Params.MinFOVCos)
+			{
+				Candidate.Stage = EAimAssistRecordedStage::RejectedFOV;
+				RejectedFOV++;
+			}
+			else if (!Snap.Targetable[i])
+			{
+				Candidate.Stage = EAimAssistRecordedStage::RejectedTargetable;
+				RejectedTargetable++;
+			}
+		}
+	}
+
+	// top-K by score, plus the current target so hysteresis can still compare against it
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AimAssist_StageTopK);
+
+		Result.LineOfSight.Reset();
+		for (int32 i = 0; i < Result.InRange.Num(); ++i)
+		{
+			if (Result.InRange[i].Stage == EAimAssistRecordedStage::Selectable)
+			{
+				Result.LineOfSight.Add(i);
+			}
+		}
+
+		const TArray<FAimAssistSelectedCandidate>& InRange = Result.InRange;
+		Result.LineOfSight.Sort([&InRange](int32 A, int32 B) { return InRange[A].Score > InRange[B].Score; });
+
+		for (int32 i = Result.LineOfSight.Num() - 1; i >= Params.MaxLineOfSightCandidates; --i)
+		{
+			FAimAssistSelectedCandidate& Candidate = Result.InRange[Result.LineOfSight[i]];
+			if (Snap.ActorKeys[Candidate.SnapshotIndex] != Params.CurrentTarget)
+			{
+				Candidate.Stage = EAimAssistRecordedStage::RejectedTopK;
+				Result.LineOfSight.RemoveAt(i, EAllowShrinking::No);
+				RejectedTopK++;
+			}
+		}
+	}
+
+	// per-stage rejection counts for 'stat AimAssist', summed over every player queried this frame
+	INC_DWORD_STAT_BY(STAT_AimAssist_RejectedRange, RejectedRange);
+	INC_DWORD_STAT_BY(STAT_AimAssist_RejectedFOV, RejectedFOV);
+	INC_DWORD_STAT_BY(STAT_AimAssist_RejectedTargetable, RejectedTargetable);
+	INC_DWORD_STAT_BY(STAT_AimAssist_RejectedTopK, RejectedTopK);
+
+	Result.SelectMs = static_cast<float>((FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+	// hand the result to the game thread; nothing below this line may touch it
+	bPublished.store(true, std::memory_order_release);
+}
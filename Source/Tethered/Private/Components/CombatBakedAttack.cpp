@@ -0,0 +1,173 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/CombatBakedAttack.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Data/CombatMontageBake.h"
+#include "Interfaces/CombatAttacker.h"
+
+// Section changes allowed in a single advance, guards against loops of zero length sections
+static constexpr int32 MaxSectionHopsPerAdvance = 8;
+
+bool FCombatBakedAttack::Play(const UCombatMontageBake* InBake, FName StartSection, float InPlayRate)
+{
+	if (!InBake || InBake->Sections.IsEmpty() || InPlayRate <= 0.0f)
+	{
+		return false;
+	}
+
+	const int32 StartIndex = StartSection.IsNone() ? 0 : InBake->FindSectionIndex(StartSection);
+	if (StartIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Bake = InBake;
+	PlayRate = InPlayRate;
+	PendingSectionIndex = INDEX_NONE;
+	bSwingOpen = false;
+	EnterSection(StartIndex);
+	return true;
+}
+
+void FCombatBakedAttack::JumpToSection(FName SectionName)
+{
+	if (const UCombatMontageBake* CurrentBake = GetBake())
+	{
+		const int32 Index = CurrentBake->FindSectionIndex(SectionName);
+		if (Index != INDEX_NONE)
+		{
+			PendingSectionIndex = Index;
+		}
+	}
+}
+
+void FCombatBakedAttack::Stop(ICombatAttacker& Attacker)
+{
+	CloseSwing(Attacker);
+	SectionIndex = INDEX_NONE;
+	PendingSectionIndex = INDEX_NONE;
+}
+
+bool FCombatBakedAttack::Advance(float DeltaTime, ICombatAttacker& Attacker)
+{
+	const UCombatMontageBake* CurrentBake = GetBake();
+	if (!CurrentBake)
+	{
+		SectionIndex = INDEX_NONE;
+		return false;
+	}
+
+	float Remaining = DeltaTime * PlayRate;
+
+	for (int32 Hop = 0; IsPlaying() && Hop <= MaxSectionHopsPerAdvance; ++Hop)
+	{
+		// apply a jump requested by an event or by input since the last advance
+		if (PendingSectionIndex != INDEX_NONE)
+		{
+			CloseSwing(Attacker);
+			EnterSection(PendingSectionIndex);
+		}
+
+		const FCombatBakedSection& Section = CurrentBake->Sections[SectionIndex];
+		const float TargetTime = FMath::Min(Time + Remaining, Section.Length);
+
+		// fire events up to the target time; an event may request a jump, which cuts the section short
+		while (NextNotify < Section.Notifies.Num() && Section.Notifies[NextNotify].Time <= TargetTime && PendingSectionIndex == INDEX_NONE)
+		{
+			const FCombatBakedNotify& Notify = Section.Notifies[NextNotify++];
+			Remaining -= FMath::Max(Notify.Time - Time, 0.0f);
+			Time = FMath::Max(Notify.Time, Time);
+
+			switch (Notify.Event)
+			{
+			case ECombatBakedEvent::AttackTrace:
+				Attacker.DoAttackTrace(Notify.BoneName);
+				break;
+
+			case ECombatBakedEvent::CheckCombo:
+				Attacker.CheckCombo();
+				break;
+
+			case ECombatBakedEvent::CheckChargedAttack:
+				Attacker.CheckChargedAttack();
+				break;
+
+			case ECombatBakedEvent::SwingBegin:
+				bSwingOpen = true;
+				Attacker.BeginAttackSwing(Notify.BoneName);
+				break;
+
+			case ECombatBakedEvent::SwingEnd:
+				CloseSwing(Attacker);
+				break;
+			}
+
+			// the attacker may have stopped the attack from inside the event
+			if (!IsPlaying())
+			{
+				return false;
+			}
+		}
+
+		if (PendingSectionIndex != INDEX_NONE)
+		{
+			continue;
+		}
+
+		Remaining -= TargetTime - Time;
+		Time = TargetTime;
+
+		// still inside the section: sweep the open swing up to the new playhead
+		if (Time < Section.Length)
+		{
+			if (bSwingOpen)
+			{
+				Attacker.TickAttackSwing();
+			}
+			return true;
+		}
+
+		// end of the section: follow its link or finish the montage
+		const int32 NextIndex = CurrentBake->FindSectionIndex(Section.NextSectionName);
+		if (NextIndex == INDEX_NONE)
+		{
+			Stop(Attacker);
+			return false;
+		}
+
+		PendingSectionIndex = NextIndex;
+	}
+
+	return IsPlaying();
+}
+
+bool FCombatBakedAttack::SampleBone(FName BoneName, const USkeletalMeshComponent& Mesh, FVector& OutLocation) const
+{
+	const UCombatMontageBake* CurrentBake = GetBake();
+	FVector MeshSpaceLocation;
+	if (!CurrentBake || !CurrentBake->SampleBone(SectionIndex, BoneName, Time, MeshSpaceLocation))
+	{
+		return false;
+	}
+
+	OutLocation = Mesh.GetComponentTransform().TransformPosition(MeshSpaceLocation);
+	return true;
+}
+
+void FCombatBakedAttack::EnterSection(int32 NewSectionIndex)
+{
+	SectionIndex = NewSectionIndex;
+	PendingSectionIndex = INDEX_NONE;
+	Time = 0.0f;
+	NextNotify = 0;
+}
+
+void FCombatBakedAttack::CloseSwing(ICombatAttacker& Attacker)
+{
+	if (bSwingOpen)
+	{
+		bSwingOpen = false;
+		Attacker.TickAttackSwing();
+		Attacker.EndAttackSwing();
+	}
+}
@@ -6,16 +6,26 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/World.h"
 #include "Interfaces/CombatDamageable.h"
+#include "Interfaces/InterfaceDispatchCache.h"
 #include "CollisionQueryParams.h"
-#include "DrawDebugHelpers.h"
+#include "Subsystems/DebugDrawSubsystem.h"
+#include "Subsystems/CombatDamageSubsystem.h"
+#include "Subsystems/HurtboxRegistrySubsystem.h"
+#include "Data/CombatMontageBake.h"
+#include "Data/VariantAssetBundles.h"
 
 #if !UE_BUILD_SHIPPING
 #include "Debug/TetheredCheatManager.h"
 #endif
 
+// Player attacks hit enemy hurtboxes and damageable props
+static constexpr EHurtboxFaction PlayerAttackTargets = EHurtboxFaction::Enemy | EHurtboxFaction::Prop;
+
 UCombatComponent::UCombatComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	// Only ticks while an attack is playing from a bake
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	
 	// Initialize default values
 	MeleeDamage = 1.0f;
@@ -33,6 +43,9 @@ UCombatComponent::UCombatComponent()
 void UCombatComponent::BeginPlay()
 {
 	Super::BeginPlay();
+	
+	// Start loading the attack montages now so the first attack doesn't have to wait on them
+	MontageLoadHandle = VariantAssets::RequestAsyncLoad({ ComboAttackMontage.ToSoftObjectPath(), ChargedAttackMontage.ToSoftObjectPath() });
 }
 
 void UCombatComponent::Initialize(ATetheredCharacter* InOwnerCharacter)
@@ -41,6 +54,25 @@ void UCombatComponent::Initialize(ATetheredCharacter* InOwnerCharacter)
 	
 	// Bind montage end delegates
 	OnAttackMontageEnded.BindUObject(this, &UCombatComponent::AttackMontageEnded);
+	
+	// Attacks run from bakes on dedicated servers, so the mesh never needs to evaluate its pose there.
+	// An attack without a bake still runs on its montage, so that only holds when both are baked
+	if (OwnerCharacter && ShouldUseBakedAttacks() && ComboAttackBake && ChargedAttackBake)
+	{
+		OwnerCharacter->GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+	}
+}
+
+void UCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	
+	// Advance the baked attack; when it finishes, end it the same way the montage end delegate would
+	if (!BakedAttack.Advance(DeltaTime, *this))
+	{
+		SetComponentTickEnabled(false);
+		AttackMontageEnded(nullptr, false);
+	}
 }
 
 void UCombatComponent::DoComboAttackStart()
@@ -101,7 +133,7 @@ void UCombatComponent::DoChargedAttackEnd()
 
 void UCombatComponent::ComboAttack()
 {
-	if (!OwnerCharacter || !ComboAttackMontage)
+	if (!OwnerCharacter || ComboAttackMontage.IsNull())
 	{
 		return;
 	}
@@ -112,25 +144,13 @@ void UCombatComponent::ComboAttack()
 	// Reset the combo count
 	ComboCount = 0;
 	
-	// Play the attack montage
-	if (UAnimInstance* AnimInstance = OwnerCharacter->GetMesh()->GetAnimInstance())
-	{
-		const float MontageLength = AnimInstance->Montage_Play(ComboAttackMontage, 1.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
-		
-		// Subscribe to montage completed and interrupted events
-		if (MontageLength > 0.0f)
-		{
-			// Set the end delegate for the montage
-			AnimInstance->Montage_SetEndDelegate(OnAttackMontageEnded, ComboAttackMontage);
-		}
-	}
-
-
+	// Play the attack from its bake or montage
+	PlayAttack(ComboAttackMontage, ComboAttackBake);
 }
 
 void UCombatComponent::ChargedAttack()
 {
-	if (!OwnerCharacter || !ChargedAttackMontage)
+	if (!OwnerCharacter || ChargedAttackMontage.IsNull())
 	{
 		return;
 	}
@@ -141,18 +161,8 @@ void UCombatComponent::ChargedAttack()
 	// Reset the charge loop flag
 	bHasLoopedChargedAttack = false;
 	
-	// Play the charged attack montage
-	if (UAnimInstance* AnimInstance = OwnerCharacter->GetMesh()->GetAnimInstance())
-	{
-		const float MontageLength = AnimInstance->Montage_Play(ChargedAttackMontage, 1.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
-		
-		// Subscribe to montage completed and interrupted events
-		if (MontageLength > 0.0f)
-		{
-			// Set the end delegate for the montage
-			AnimInstance->Montage_SetEndDelegate(OnAttackMontageEnded, ChargedAttackMontage);
-		}
-	}
+	// Play the charged attack from its bake or montage
+	PlayAttack(ChargedAttackMontage, ChargedAttackBake);
 }
 
 void UCombatComponent::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupted)
@@ -160,6 +170,9 @@ void UCombatComponent::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupt
 	// Reset the attacking flag
 	bIsAttacking = false;
 	
+	// An interrupted montage may never reach the end of its swing window
+	SwingTrace.End();
+	
 	// Check if we have a non-stale cached input
 	if (GetWorld() && GetWorld()->GetTimeSeconds() - CachedAttackInputTime <= AttackInputCacheTimeTolerance)
 	{
@@ -177,6 +190,80 @@ void UCombatComponent::AttackMontageEnded(UAnimMontage* Montage, bool bInterrupt
 	}
 }
 
+bool UCombatComponent::ShouldUseBakedAttacks() const
+{
+	return GetNetMode() == NM_DedicatedServer;
+}
+
+bool UCombatComponent::PlayAttack(const TSoftObjectPtr<UAnimMontage>& MontagePtr, UCombatMontageBake* Bake)
+{
+	// A new attack replaces a baked one that's still playing, which ends as interrupted like a replaced montage would
+	if (BakedAttack.IsPlaying())
+	{
+		BakedAttack.Stop(*this);
+		AttackMontageEnded(nullptr, true);
+		
+		// The interrupt may have started a follow-up attack from cached input; that one takes over
+		if (bIsAttacking)
+		{
+			return true;
+		}
+		
+		bIsAttacking = true;
+	}
+	
+	if (Bake && ShouldUseBakedAttacks())
+	{
+		if (BakedAttack.Play(Bake))
+		{
+			SetComponentTickEnabled(true);
+			return true;
+		}
+	}
+	
+	// The montage is normally loaded by now; if it isn't, finish loading it rather than drop the attack
+	UAnimMontage* Montage = VariantAssets::Resolve(MontagePtr);
+	
+	if (UAnimInstance* AnimInstance = OwnerCharacter->GetMesh()->GetAnimInstance())
+	{
+		const float MontageLength = AnimInstance->Montage_Play(Montage, 1.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
+		
+		// Subscribe to montage completed and interrupted events
+		if (MontageLength > 0.0f)
+		{
+			// Set the end delegate for the montage
+			AnimInstance->Montage_SetEndDelegate(OnAttackMontageEnded, Montage);
+			return true;
+		}
+	}
+	
+	return false;
+}
+
+void UCombatComponent::JumpToAttackSection(FName SectionName, UAnimMontage* Montage)
+{
+	if (BakedAttack.IsPlaying())
+	{
+		BakedAttack.JumpToSection(SectionName);
+	}
+	else if (UAnimInstance* AnimInstance = OwnerCharacter->GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->Montage_JumpToSection(SectionName, Montage);
+	}
+}
+
+FVector UCombatComponent::GetDamageSourceLocation(FName DamageSourceBone) const
+{
+	// Baked attacks carry their own bone positions; the pose isn't evaluated while they play
+	FVector Location;
+	if (BakedAttack.IsPlaying() && BakedAttack.SampleBone(DamageSourceBone, *OwnerCharacter->GetMesh(), Location))
+	{
+		return Location;
+	}
+	
+	return OwnerCharacter->GetMesh()->GetSocketLocation(DamageSourceBone);
+}
+
 void UCombatComponent::DoAttackTrace(FName DamageSourceBone)
 {
 	if (!OwnerCharacter)
@@ -188,27 +275,17 @@ void UCombatComponent::DoAttackTrace(FName DamageSourceBone)
 	TArray<FHitResult> OutHits;
 	
 	// Start at the provided socket location, sweep forward
-	const FVector TraceStart = OwnerCharacter->GetMesh()->GetSocketLocation(DamageSourceBone);
+	const FVector TraceStart = GetDamageSourceLocation(DamageSourceBone);
 	const FVector TraceEnd = TraceStart + (OwnerCharacter->GetActorForwardVector() * MeleeTraceDistance);
 	
-	// Check for pawn and world dynamic collision object types
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
-	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
-	
-	// Use a sphere shape for the sweep
-	FCollisionShape CollisionShape;
-	CollisionShape.SetSphere(MeleeTraceRadius);
-	
-	// Ignore self
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(OwnerCharacter);
-	
 	// Check if debug visualization is enabled via the global combat debug state
 	const bool bShouldShowDebug = bDebugShowTraces || IsGlobalCombatDebugEnabled();
 	
+	// Debug shapes go through the retained debug layer, which batches them into one submission per frame
+	UDebugDrawSubsystem* DebugDraw = (bShouldShowDebug && GetWorld()) ? GetWorld()->GetSubsystem<UDebugDrawSubsystem>() : nullptr;
+	
 	// Add debug visualization
-	if (bShouldShowDebug && GetWorld())
+	if (DebugDraw)
 	{
 		// Draw the sweep as a series of spheres along the path
 		const int32 NumSpheres = 5;
@@ -222,74 +299,131 @@ void UCombatComponent::DoAttackTrace(FName DamageSourceBone)
 			if (i == 0) SphereColor = FColor::Green;
 			else if (i == NumSpheres) SphereColor = FColor::Red;
 			
-			DrawDebugSphere(GetWorld(), SphereCenter, MeleeTraceRadius, 12, SphereColor, false, 2.0f, 0, 1.0f);
+			DebugDraw->AddShape(UDebugDrawSubsystem::SphereShape(12), FTransform(FQuat::Identity, SphereCenter, FVector(MeleeTraceRadius)), SphereColor, 1.0f, 2.0f);
 		}
 		
 		// Draw a line from start to end
-		DrawDebugLine(GetWorld(), TraceStart, TraceEnd, FColor::Cyan, false, 2.0f, 0, 2.0f);
+		DebugDraw->AddLine(TraceStart, TraceEnd, FColor::Cyan, 2.0f, 2.0f);
 		
 		// Draw direction arrow
-		DrawDebugDirectionalArrow(GetWorld(), TraceStart, TraceEnd, 50.0f, FColor::Blue, false, 2.0f, 0, 3.0f);
+		DebugDraw->AddArrow(TraceStart, TraceEnd, 50.0f, FColor::Blue, 3.0f, 2.0f);
 		
 		// Draw trace info text
-		DrawDebugString(GetWorld(), TraceStart + FVector(0, 0, 100), 
+		DebugDraw->AddText(TraceStart + FVector(0, 0, 100), 
 			FString::Printf(TEXT("Combat Trace: %.1fcm x %.1fcm"), MeleeTraceDistance, MeleeTraceRadius * 2.0f), 
-			nullptr, FColor::White, 2.0f);
+			FColor::White, 2.0f);
 	}
 	
-	if (GetWorld()->SweepMultiByObjectType(OutHits, TraceStart, TraceEnd, FQuat::Identity, ObjectParams, CollisionShape, QueryParams))
+	// Only enemy hurtboxes and damageable props can be hit, never ourselves
+	if (UHurtboxRegistrySubsystem::SweepMelee(*GetWorld(), TraceStart, TraceEnd, MeleeTraceRadius, PlayerAttackTargets, OwnerCharacter, OutHits))
 	{
 		// Iterate over each object hit
 		for (const FHitResult& CurrentHit : OutHits)
 		{
-			// Debug visualization for hits
-			if (bShouldShowDebug && GetWorld())
-			{
-				// Draw impact point and normal
-				DrawDebugSphere(GetWorld(), CurrentHit.ImpactPoint, 10.0f, 8, FColor::Orange, false, 3.0f, 0, 2.0f);
-				DrawDebugLine(GetWorld(), CurrentHit.ImpactPoint, CurrentHit.ImpactPoint + (CurrentHit.ImpactNormal * 100.0f), FColor::White, false, 3.0f, 0, 3.0f);
-				
-				// Draw text with actor name and damage info
-				if (CurrentHit.GetActor())
-				{
-					DrawDebugString(GetWorld(), CurrentHit.ImpactPoint + FVector(0, 0, 50), 
-						FString::Printf(TEXT("HIT: %s (%.1f dmg)"), *CurrentHit.GetActor()->GetName(), MeleeDamage), 
-						nullptr, FColor::Red, 3.0f, true);
-				}
-			}
-			
-			// Check if we've hit a damageable actor
-			if (ICombatDamageable* Damageable = Cast<ICombatDamageable>(CurrentHit.GetActor()))
-			{
-				// Knock upwards and away from the impact normal
-				const FVector Impulse = (CurrentHit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
-				
-				// Pass the damage event to the actor
-				Damageable->ApplyDamage(MeleeDamage, OwnerCharacter, CurrentHit.ImpactPoint, Impulse);
-				
-				// Call the Blueprint event on the character
-				if (OwnerCharacter)
-				{
-					OwnerCharacter->OnDealtDamage(MeleeDamage, CurrentHit.ImpactPoint);
-				}
-			}
+			ApplyMeleeHit(CurrentHit, DebugDraw);
 		}
 	}
 	else
 	{
 		// Debug visualization when no hits
-		if (bShouldShowDebug && GetWorld())
+		if (DebugDraw)
 		{
-			// Draw the full sweep in a dimmer color to show it didn't hit anything
-			DrawDebugCapsule(GetWorld(), (TraceStart + TraceEnd) * 0.5f, MeleeTraceDistance * 0.5f + MeleeTraceRadius, MeleeTraceRadius, 
-				FQuat::FindBetweenNormals(FVector::UpVector, OwnerCharacter->GetActorForwardVector()), 
-				FColor::Red, false, 2.0f, 0, 1.0f);
+			// Draw the full sweep in a dimmer color to show it didn't hit anything: end caps plus side lines
+			const FVector Side = FVector::CrossProduct(OwnerCharacter->GetActorForwardVector(), FVector::UpVector).GetSafeNormal() * MeleeTraceRadius;
+			const FVector Up = FVector::UpVector * MeleeTraceRadius;
+			DebugDraw->AddShape(UDebugDrawSubsystem::SphereShape(12), FTransform(FQuat::Identity, TraceStart, FVector(MeleeTraceRadius)), FColor::Red, 1.0f, 2.0f);
+			DebugDraw->AddShape(UDebugDrawSubsystem::SphereShape(12), FTransform(FQuat::Identity, TraceEnd, FVector(MeleeTraceRadius)), FColor::Red, 1.0f, 2.0f);
+			DebugDraw->AddLine(TraceStart + Side, TraceEnd + Side, FColor::Red, 1.0f, 2.0f);
+			DebugDraw->AddLine(TraceStart - Side, TraceEnd - Side, FColor::Red, 1.0f, 2.0f);
+			DebugDraw->AddLine(TraceStart + Up, TraceEnd + Up, FColor::Red, 1.0f, 2.0f);
+			DebugDraw->AddLine(TraceStart - Up, TraceEnd - Up, FColor::Red, 1.0f, 2.0f);
 			
-			DrawDebugString(GetWorld(), TraceStart + FVector(0, 0, 50), TEXT("NO HITS"), nullptr, FColor::Red, 2.0f);
+			DebugDraw->AddText(TraceStart + FVector(0, 0, 50), TEXT("NO HITS"), FColor::Red, 2.0f);
 		}
 	}
 }
 
+void UCombatComponent::ApplyMeleeHit(const FHitResult& Hit, UDebugDrawSubsystem* DebugDraw)
+{
+	// Debug visualization for hits
+	if (DebugDraw)
+	{
+		// Draw impact point and normal
+		DebugDraw->AddShape(UDebugDrawSubsystem::SphereShape(8), FTransform(FQuat::Identity, Hit.ImpactPoint, FVector(10.0f)), FColor::Orange, 2.0f, 3.0f);
+		DebugDraw->AddLine(Hit.ImpactPoint, Hit.ImpactPoint + (Hit.ImpactNormal * 100.0f), FColor::White, 3.0f, 3.0f);
+		
+		// Draw text with actor name and damage info
+		if (Hit.GetActor())
+		{
+			DebugDraw->AddText(Hit.ImpactPoint + FVector(0, 0, 50), 
+				FString::Printf(TEXT("HIT: %s (%.1f dmg)"), *Hit.GetActor()->GetName(), MeleeDamage), 
+				FColor::Red, 3.0f);
+		}
+	}
+	
+	// Check if we've hit a damageable actor
+	if (FInterfaceDispatchCache::GetDamageable(Hit.GetActor()))
+	{
+		// Knock upwards and away from the impact normal
+		const FVector Impulse = (Hit.ImpactNormal * -MeleeKnockbackImpulse) + (FVector::UpVector * MeleeLaunchImpulse);
+		
+		// Queue the damage event; the actor reacts once per frame however many hits it took
+		UCombatDamageSubsystem::ApplyOrQueueDamage(Hit.GetActor(), MeleeDamage, OwnerCharacter, Hit.ImpactPoint, Impulse);
+		
+		// Call the Blueprint event on the character
+		if (OwnerCharacter)
+		{
+			OwnerCharacter->OnDealtDamage(MeleeDamage, Hit.ImpactPoint);
+		}
+	}
+}
+
+void UCombatComponent::BeginAttackSwing(FName DamageSourceBone)
+{
+	if (!OwnerCharacter)
+	{
+		return;
+	}
+	
+	// Start following the bone and sweep its starting position right away
+	SwingTrace.Begin(OwnerCharacter->GetMesh(), DamageSourceBone);
+	TickAttackSwing();
+}
+
+void UCombatComponent::TickAttackSwing()
+{
+	if (!OwnerCharacter || !SwingTrace.IsActive())
+	{
+		return;
+	}
+	
+	const bool bShouldShowDebug = bDebugShowTraces || IsGlobalCombatDebugEnabled();
+	UDebugDrawSubsystem* DebugDraw = (bShouldShowDebug && GetWorld()) ? GetWorld()->GetSubsystem<UDebugDrawSubsystem>() : nullptr;
+	
+	// Baked attacks supply the bone position; otherwise the trace samples the animated mesh
+	const bool bHitNew = BakedAttack.IsPlaying()
+		? SwingTrace.AdvanceTo(*GetWorld(), GetDamageSourceLocation(SwingTrace.GetSourceName()), PlayerAttackTargets, MeleeTraceRadius, OwnerCharacter, SwingHits)
+		: SwingTrace.Advance(*GetWorld(), PlayerAttackTargets, MeleeTraceRadius, OwnerCharacter, SwingHits);
+	
+	// Draw the swept segment: spheres at both ends joined by a line, green when it found new targets
+	if (DebugDraw)
+	{
+		const FColor SegmentColor = bHitNew ? FColor::Green : FColor::Yellow;
+		DebugDraw->AddShape(UDebugDrawSubsystem::SphereShape(8), FTransform(FQuat::Identity, SwingTrace.GetSegmentEnd(), FVector(MeleeTraceRadius)), SegmentColor, 1.0f, 1.0f);
+		DebugDraw->AddLine(SwingTrace.GetSegmentStart(), SwingTrace.GetSegmentEnd(), FColor::Cyan, 2.0f, 1.0f);
+	}
+	
+	for (const FHitResult& Hit : SwingHits)
+	{
+		ApplyMeleeHit(Hit, DebugDraw);
+	}
+}
+
+void UCombatComponent::EndAttackSwing()
+{
+	SwingTrace.End();
+}
+
 void UCombatComponent::CheckCombo()
 {
 	if (!OwnerCharacter)
@@ -314,10 +448,7 @@ void UCombatComponent::CheckCombo()
 			if (ComboCount < ComboSectionNames.Num())
 			{
 				// Jump to the next combo section
-				if (UAnimInstance* AnimInstance = OwnerCharacter->GetMesh()->GetAnimInstance())
-				{
-					AnimInstance->Montage_JumpToSection(ComboSectionNames[ComboCount], ComboAttackMontage);
-				}
+				JumpToAttackSection(ComboSectionNames[ComboCount], ComboAttackMontage.Get());
 			}
 		}
 	}
@@ -334,10 +465,7 @@ void UCombatComponent::CheckChargedAttack()
 	bHasLoopedChargedAttack = true;
 	
 	// Jump to either the loop or the attack section depending on whether we're still holding the charge button
-	if (UAnimInstance* AnimInstance = OwnerCharacter->GetMesh()->GetAnimInstance())
-	{
-		AnimInstance->Montage_JumpToSection(bIsChargingAttack ? ChargeLoopSection : ChargeAttackSection, ChargedAttackMontage);
-	}
+	JumpToAttackSection(bIsChargingAttack ? ChargeLoopSection : ChargeAttackSection, ChargedAttackMontage.Get());
 }
 
 bool UCombatComponent::IsGlobalCombatDebugEnabled()
@@ -10,6 +10,7 @@
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "CollisionQueryParams.h"
+#include "Data/VariantAssetBundles.h"
 
 UDashComponent::UDashComponent()
 {
@@ -28,6 +29,9 @@ UDashComponent::UDashComponent()
 void UDashComponent::BeginPlay()
 {
 	Super::BeginPlay();
+	
+	// Start loading the dash montage now so the first dash doesn't have to wait on it
+	MontageLoadHandle = VariantAssets::RequestAsyncLoad({ DashMontage.ToSoftObjectPath() });
 }
 
 void UDashComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -49,12 +53,13 @@ void UDashComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorC
 			OwnerCharacter->SetActorLocation(DashTargetLocation);
 			bIsDashing = false;
 			// End the dash montage if it's still playing
-			if (DashMontage && OwnerCharacter->GetMesh()->GetAnimInstance()->Montage_IsPlaying(DashMontage))
+			UAnimMontage* LoadedDashMontage = DashMontage.Get();
+			if (LoadedDashMontage && OwnerCharacter->GetMesh()->GetAnimInstance()->Montage_IsPlaying(LoadedDashMontage))
 			{
-				OwnerCharacter->GetMesh()->GetAnimInstance()->Montage_Stop(0.1f, DashMontage);
+				OwnerCharacter->GetMesh()->GetAnimInstance()->Montage_Stop(0.1f, LoadedDashMontage);
 			}
 			// Call the dash ended handler
-			DashMontageEnded(DashMontage, true);
+			DashMontageEnded(LoadedDashMontage, true);
 		}
 		else
 		{
@@ -119,17 +124,18 @@ void UDashComponent::DoDash()
 	// Notify derived classes about dash state change
 	OnDashStateChanged(true);
 	
-	// Play the dash montage
-	if (DashMontage && OwnerCharacter->GetMesh())
+	// Play the dash montage, finishing its load first if it somehow hasn't completed yet
+	UAnimMontage* LoadedDashMontage = VariantAssets::Resolve(DashMontage);
+	if (LoadedDashMontage && OwnerCharacter->GetMesh())
 	{
 		if (UAnimInstance* AnimInstance = OwnerCharacter->GetMesh()->GetAnimInstance())
 		{
-			const float MontageLength = AnimInstance->Montage_Play(DashMontage, 2.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
+			const float MontageLength = AnimInstance->Montage_Play(LoadedDashMontage, 2.0f, EMontagePlayReturnType::MontageLength, 0.0f, true);
 			
 			// Has the montage played successfully?
 			if (MontageLength > 0.0f)
 			{
-				AnimInstance->Montage_SetEndDelegate(OnDashMontageEnded, DashMontage);
+				AnimInstance->Montage_SetEndDelegate(OnDashMontageEnded, LoadedDashMontage);
 			}
 		}
 	}
@@ -7,6 +7,7 @@
 #include "GameFramework/SpringArmComponent.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
+#include "Subsystems/RagdollBudgetSubsystem.h"
 
 UHealthComponent::UHealthComponent()
 {
@@ -40,6 +41,8 @@ void UHealthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		GetWorld()->GetTimerManager().ClearTimer(RespawnTimer);
 	}
+
+	ReleaseRagdoll();
 	
 	Super::EndPlay(EndPlayReason);
 }
@@ -52,7 +55,8 @@ void UHealthComponent::Initialize(ATetheredCharacter* InOwnerCharacter, UCombatL
 	// Set up the life bar widget if available
 	if (LifeBarWidget)
 	{
-		LifeBarWidget->SetBarColor(LifeBarColor);
+		LifeBarViewModel.Bind(LifeBarWidget);
+		LifeBarViewModel.SetBarColor(LifeBarColor);
 		UpdateLifeBarUI();
 	}
 }
@@ -93,6 +97,7 @@ void UHealthComponent::RespawnCharacter()
 		{
 			Mesh->SetPhysicsBlendWeight(0.0f);
 			Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+			ReleaseRagdoll();
 			
 			// Reset mesh transform
 			Mesh->SetRelativeTransform(OwnerCharacter->GetMeshStartingTransform());
@@ -117,10 +122,8 @@ void UHealthComponent::RespawnCharacter()
 
 void UHealthComponent::UpdateLifeBarUI()
 {
-	if (LifeBarWidget)
-	{
-		LifeBarWidget->SetLifePercentage(GetHealthPercentage());
-	}
+	// Only stores the value; several hits in one frame still cost a single widget update
+	LifeBarViewModel.SetLifePercentage(GetHealthPercentage());
 }
 
 void UHealthComponent::ApplyDamage(float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse)
@@ -178,6 +181,12 @@ void UHealthComponent::HandleDeath()
 		{
 			Mesh->AddImpulse(FVector(0.0f, 0.0f, 300.0f), PelvisBoneName);
 		}
+
+		// The player's ragdoll counts against the budget but is never frozen, since the camera stays on it
+		if (URagdollBudgetSubsystem* RagdollBudget = GetWorld() ? GetWorld()->GetSubsystem<URagdollBudgetSubsystem>() : nullptr)
+		{
+			RagdollBudget->RegisterRagdoll(Mesh, false);
+		}
 	}
 	
 	// Adjust camera distance for death
@@ -197,4 +206,14 @@ void UHealthComponent::HandleDeath()
 			false
 		);
 	}
-}
\ No newline at end of file
+}
+
+void UHealthComponent::ReleaseRagdoll()
+{
+	UWorld* World = GetWorld();
+	URagdollBudgetSubsystem* RagdollBudget = World ? World->GetSubsystem<URagdollBudgetSubsystem>() : nullptr;
+	if (RagdollBudget && OwnerCharacter)
+	{
+		RagdollBudget->UnregisterRagdoll(OwnerCharacter->GetMesh());
+	}
+}
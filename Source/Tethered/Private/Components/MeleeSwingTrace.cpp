@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/MeleeSwingTrace.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "Engine/World.h"
+
+void FMeleeSwingTrace::Begin(USkeletalMeshComponent* InMesh, FName InSourceName)
+{
+	if (!InMesh)
+	{
+		End();
+		return;
+	}
+
+	// resolve the bone or socket only when the mesh, its asset or the name changed since the last swing
+	const UObject* Asset = InMesh->GetSkinnedAsset();
+	if (Mesh.Get() != InMesh || ResolvedAsset.Get() != Asset || SourceName != InSourceName)
+	{
+		Mesh = InMesh;
+		ResolvedAsset = Asset;
+		SourceName = InSourceName;
+		Socket = InMesh->GetSocketByName(InSourceName);
+		BoneIndex = Socket ? INDEX_NONE : InMesh->GetBoneIndex(InSourceName);
+	}
+
+	HitActors.Reset();
+	bActive = true;
+	bHasSample = false;
+}
+
+void FMeleeSwingTrace::End()
+{
+	bActive = false;
+	bHasSample = false;
+	HitActors.Reset();
+}
+
+bool FMeleeSwingTrace::Advance(UWorld& World, EHurtboxFaction Targets, float Radius, const AActor* IgnoreActor, TArray<FHitResult>& OutNewHits)
+{
+	const USkeletalMeshComponent* MeshComp = Mesh.Get();
+	if (!bActive || !MeshComp)
+	{
+		OutNewHits.Reset();
+		return false;
+	}
+
+	return AdvanceTo(World, SampleLocation(*MeshComp), Targets, Radius, IgnoreActor, OutNewHits);
+}
+
+bool FMeleeSwingTrace::AdvanceTo(UWorld& World, const FVector& Current, EHurtboxFaction Targets, float Radius, const AActor* IgnoreActor, TArray<FHitResult>& OutNewHits)
+{
+	OutNewHits.Reset();
+
+	if (!bActive)
+	{
+		return false;
+	}
+
+	// the first sample of a swing sweeps in place; every later one covers the path since the previous sample
+	SegmentStart = bHasSample ? LastLocation : Current;
+	SegmentEnd = Current;
+	LastLocation = Current;
+	bHasSample = true;
+
+	UHurtboxRegistrySubsystem::SweepMelee(World, SegmentStart, SegmentEnd, Radius, Targets, IgnoreActor, SweepHits);
+
+	// report each actor once per swing, however many of its components or sweeps touched it
+	for (const FHitResult& Hit : SweepHits)
+	{
+		AActor* HitActor = Hit.GetActor();
+		if (!HitActor || HitActors.Contains(HitActor))
+		{
+			continue;
+		}
+
+		HitActors.Add(HitActor);
+		OutNewHits.Add(Hit);
+	}
+
+	return !OutNewHits.IsEmpty();
+}
+
+FVector FMeleeSwingTrace::SampleLocation(const USkeletalMeshComponent& MeshComp) const
+{
+	if (Socket)
+	{
+		return Socket->GetSocketLocation(&MeshComp);
+	}
+
+	if (BoneIndex != INDEX_NONE)
+	{
+		return MeshComp.GetBoneTransform(BoneIndex).GetLocation();
+	}
+
+	// unknown names follow the component, same as GetSocketLocation does
+	return MeshComp.GetComponentLocation();
+}
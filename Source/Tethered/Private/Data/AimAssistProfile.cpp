@@ -0,0 +1,57 @@
+// AimAssistProfile.cpp
+#include "Data/AimAssistProfile.h"
+#include "Components/AimAssistScoring.h"
+
+/** Samples a designer curve into a lookup table, or a default response when the curve has no keys */
+static void BakeLUT(const FRuntimeFloatCurve& Curve, float (&OutLUT)[FAimAssistCompiledProfile::LUTSegments + 1], TFunctionRef<float(float)> Default)
+{
+	const FRichCurve* RichCurve = Curve.GetRichCurveConst();
+	const bool bHasCurve = RichCurve && RichCurve->GetNumKeys() > 0;
+
+	for (int32 i = 0; i <= FAimAssistCompiledProfile::LUTSegments; ++i)
+	{
+		const float X = static_cast<float>(i) / FAimAssistCompiledProfile::LUTSegments;
+		OutLUT[i] = bHasCurve ? RichCurve->Eval(X) : Default(X);
+	}
+}
+
+void UAimAssistProfile::Compile()
+{
+	// Query thresholds
+	Compiled.RangeCm = AssistRangeCm;
+	Compiled.InvRangeCm = AssistRangeCm > 0.f ? 1.f / AssistRangeCm : 0.f;
+	Compiled.CosQueryFOV = FMath::Cos(FMath::DegreesToRadians(QueryFOVDeg));
+	Compiled.Stickiness = Stickiness;
+	Compiled.HysteresisMultiplier = AimAssistScoring::GetHysteresisMultiplier(Stickiness);
+
+	// Assist thresholds
+	Compiled.CosSnapCone = FMath::Cos(FMath::DegreesToRadians(SnapConeDeg));
+	Compiled.SnapConeDeg = SnapConeDeg;
+	Compiled.MaxSnapDeg = MaxSnapDeg;
+	Compiled.MaxYawDegPerSec = MaxYawDegPerSec;
+
+	// Response curves; the defaults reproduce the behavior from before curves existed
+	BakeLUT(StickStrengthCurve, Compiled.StickStrengthLUT, [](float X) { return FMath::Lerp(1.f, 0.25f, X); });
+	BakeLUT(DistanceFalloffCurve, Compiled.DistanceFalloffLUT, [](float) { return 1.f; });
+	BakeLUT(AngleFalloffCurve, Compiled.AngleFalloffLUT, [](float) { return 1.f; });
+}
+
+void UAimAssistProfile::PostInitProperties()
+{
+	Super::PostInitProperties();
+	Compile();
+}
+
+void UAimAssistProfile::PostLoad()
+{
+	Super::PostLoad();
+	Compile();
+}
+
+#if WITH_EDITOR
+void UAimAssistProfile::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	Compile();
+}
+#endif
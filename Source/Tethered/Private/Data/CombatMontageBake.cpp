@@ -0,0 +1,239 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Data/CombatMontageBake.h"
+
+#if WITH_EDITOR
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimSequenceBase.h"
+#include "Animation/AnimationPoseData.h"
+#include "Animation/AttributesRuntime.h"
+#include "Animation/AnimNotify_DoAttackTrace.h"
+#include "Animation/AnimNotify_CheckCombo.h"
+#include "Animation/AnimNotify_CheckChargedAttack.h"
+#include "Animation/AnimNotifyState_AttackSwing.h"
+#include "BonePose.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/SkeletalMeshSocket.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCombatBake, Log, All);
+#endif
+
+int32 UCombatMontageBake::FindSectionIndex(FName SectionName) const
+{
+	return Sections.IndexOfByPredicate([SectionName](const FCombatBakedSection& Section) { return Section.SectionName == SectionName; });
+}
+
+bool UCombatMontageBake::SampleBone(int32 SectionIndex, FName BoneName, float Time, FVector& OutMeshSpaceLocation) const
+{
+	if (!Sections.IsValidIndex(SectionIndex))
+	{
+		return false;
+	}
+
+	const FCombatBakedTrack* Track = Sections[SectionIndex].Tracks.FindByPredicate([BoneName](const FCombatBakedTrack& Candidate) { return Candidate.BoneName == BoneName; });
+	if (!Track || Track->Positions.IsEmpty())
+	{
+		return false;
+	}
+
+	// linear interpolation between the two nearest samples
+	const float SampleTime = FMath::Max(Time, 0.0f) * SampleRate;
+	const int32 LastIndex = Track->Positions.Num() - 1;
+	const int32 Index = FMath::Min(static_cast<int32>(SampleTime), LastIndex);
+	const int32 NextIndex = FMath::Min(Index + 1, LastIndex);
+
+	OutMeshSpaceLocation = FVector(FMath::Lerp(Track->Positions[Index], Track->Positions[NextIndex], FMath::Min(SampleTime - Index, 1.0f)));
+	return true;
+}
+
+#if WITH_EDITOR
+namespace
+{
+	/** Bone chain and offset needed to evaluate one damage source */
+	struct FBakeSource
+	{
+		FName Name;
+		FCompactPoseBoneIndex CompactIndex = FCompactPoseBoneIndex(INDEX_NONE);
+		FTransform SocketLocal = FTransform::Identity;
+	};
+
+	/** Builds a baked event */
+	FCombatBakedNotify MakeEvent(float Time, ECombatBakedEvent Event, FName BoneName)
+	{
+		FCombatBakedNotify Notify;
+		Notify.Time = Time;
+		Notify.Event = Event;
+		Notify.BoneName = BoneName;
+		return Notify;
+	}
+
+	/** Converts a montage notify into a combat event, if it is one */
+	bool ClassifyNotify(const FAnimNotifyEvent& NotifyEvent, TArray<FCombatBakedNotify, TInlineAllocator<2>>& OutEvents)
+	{
+		const float Start = NotifyEvent.GetTriggerTime();
+
+		if (const UAnimNotify_DoAttackTrace* AttackTrace = Cast<UAnimNotify_DoAttackTrace>(NotifyEvent.Notify))
+		{
+			OutEvents.Add(MakeEvent(Start, ECombatBakedEvent::AttackTrace, AttackTrace->GetAttackBoneName()));
+		}
+		else if (Cast<UAnimNotify_CheckCombo>(NotifyEvent.Notify))
+		{
+			OutEvents.Add(MakeEvent(Start, ECombatBakedEvent::CheckCombo, NAME_None));
+		}
+		else if (Cast<UAnimNotify_CheckChargedAttack>(NotifyEvent.Notify))
+		{
+			OutEvents.Add(MakeEvent(Start, ECombatBakedEvent::CheckChargedAttack, NAME_None));
+		}
+		else if (const UAnimNotifyState_AttackSwing* Swing = Cast<UAnimNotifyState_AttackSwing>(NotifyEvent.NotifyStateClass))
+		{
+			OutEvents.Add(MakeEvent(Start, ECombatBakedEvent::SwingBegin, Swing->GetAttackBoneName()));
+			OutEvents.Add(MakeEvent(NotifyEvent.GetEndTriggerTime(), ECombatBakedEvent::SwingEnd, Swing->GetAttackBoneName()));
+		}
+
+		return !OutEvents.IsEmpty();
+	}
+}
+
+bool UCombatMontageBake::BakeFrom(UAnimMontage* Montage, USkeletalMesh* Mesh, float InSampleRate)
+{
+	if (!Montage || !Mesh || Montage->SlotAnimTracks.IsEmpty() || InSampleRate <= 0.0f)
+	{
+		return false;
+	}
+
+	SourceMontage = Montage;
+	SourceMesh = Mesh;
+	SampleRate = InSampleRate;
+	Sections.Reset();
+
+	// evaluate every bone of the mesh so component space transforms are complete
+	const FReferenceSkeleton& RefSkeleton = Mesh->GetRefSkeleton();
+	TArray<FBoneIndexType> RequiredBones;
+	RequiredBones.SetNumUninitialized(RefSkeleton.GetNum());
+	for (int32 BoneIndex = 0; BoneIndex < RefSkeleton.GetNum(); ++BoneIndex)
+	{
+		RequiredBones[BoneIndex] = static_cast<FBoneIndexType>(BoneIndex);
+	}
+
+	FBoneContainer BoneContainer;
+	BoneContainer.InitializeTo(RequiredBones, UE::Anim::FCurveFilterSettings(UE::Anim::ECurveFilterMode::DisallowAll), *Mesh);
+
+	FCompactPose Pose;
+	Pose.SetBoneContainer(&BoneContainer);
+	FBlendedCurve Curve;
+	Curve.InitFrom(BoneContainer);
+	UE::Anim::FStackAttributeContainer Attributes;
+	FCSPose<FCompactPose> ComponentSpacePose;
+
+	const FAnimTrack& AnimTrack = Montage->SlotAnimTracks[0].AnimTrack;
+
+	for (int32 SectionIndex = 0; SectionIndex < Montage->CompositeSections.Num(); ++SectionIndex)
+	{
+		const FCompositeSection& CompositeSection = Montage->CompositeSections[SectionIndex];
+		const float SectionStart = CompositeSection.GetTime();
+		const float SectionLength = Montage->GetSectionLength(SectionIndex);
+		const float SectionEnd = SectionStart + SectionLength;
+
+		FCombatBakedSection& Section = Sections.AddDefaulted_GetRef();
+		Section.SectionName = CompositeSection.SectionName;
+		Section.NextSectionName = CompositeSection.NextSectionName;
+		Section.Length = SectionLength;
+
+		// combat notifies that start inside this section; swing ends are clamped to the section
+		TArray<FBakeSource, TInlineAllocator<4>> BakeSources;
+		for (const FAnimNotifyEvent& NotifyEvent : Montage->Notifies)
+		{
+			const float TriggerTime = NotifyEvent.GetTriggerTime();
+			if (TriggerTime < SectionStart || TriggerTime >= SectionEnd)
+			{
+				continue;
+			}
+
+			TArray<FCombatBakedNotify, TInlineAllocator<2>> Events;
+			if (!ClassifyNotify(NotifyEvent, Events))
+			{
+				continue;
+			}
+
+			for (FCombatBakedNotify& Event : Events)
+			{
+				Event.Time = FMath::Clamp(Event.Time - SectionStart, 0.0f, SectionLength);
+				Section.Notifies.Add(Event);
+
+				if (Event.BoneName.IsNone() || BakeSources.ContainsByPredicate([&Event](const FBakeSource& Source) { return Source.Name == Event.BoneName; }))
+				{
+					continue;
+				}
+
+				// sockets are followed through their parent bone, same as GetSocketLocation
+				FBakeSource Source;
+				Source.Name = Event.BoneName;
+				FName BoneName = Event.BoneName;
+				if (const USkeletalMeshSocket* Socket = Mesh->FindSocket(Event.BoneName))
+				{
+					BoneName = Socket->BoneName;
+					Source.SocketLocal = Socket->GetSocketLocalTransform();
+				}
+
+				const int32 MeshBoneIndex = RefSkeleton.FindBoneIndex(BoneName);
+				if (MeshBoneIndex == INDEX_NONE)
+				{
+					UE_LOG(LogCombatBake, Warning, TEXT("%s: '%s' is not a bone or socket of %s, it will follow the live mesh"),
+						*Montage->GetName(), *Event.BoneName.ToString(), *Mesh->GetName());
+					continue;
+				}
+
+				Source.CompactIndex = BoneContainer.MakeCompactPoseIndex(FMeshPoseBoneIndex(MeshBoneIndex));
+				BakeSources.Add(Source);
+			}
+		}
+
+		Section.Notifies.StableSort([](const FCombatBakedNotify& A, const FCombatBakedNotify& B) { return A.Time < B.Time; });
+
+		if (BakeSources.IsEmpty())
+		{
+			continue;
+		}
+
+		for (const FBakeSource& Source : BakeSources)
+		{
+			Section.Tracks.AddDefaulted_GetRef().BoneName = Source.Name;
+		}
+
+		// sample the montage's slot track at a fixed rate across the section
+		const int32 NumSamples = FMath::Max(1, FMath::CeilToInt(SectionLength * SampleRate)) + 1;
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			const float TrackTime = FMath::Min(SectionStart + SampleIndex / SampleRate, SectionEnd - UE_KINDA_SMALL_NUMBER);
+			const FAnimSegment* Segment = AnimTrack.GetSegmentAtTime(TrackTime);
+			const UAnimSequenceBase* Animation = Segment ? Segment->GetAnimReference().Get() : nullptr;
+
+			if (Animation)
+			{
+				FAnimationPoseData PoseData(Pose, Curve, Attributes);
+				Animation->GetAnimationPose(PoseData, FAnimExtractContext(static_cast<double>(Segment->ConvertTrackPosToAnimPos(TrackTime)), false));
+				ComponentSpacePose.InitPose(Pose);
+			}
+
+			for (int32 SourceIndex = 0; SourceIndex < BakeSources.Num(); ++SourceIndex)
+			{
+				TArray<FVector3f>& Positions = Section.Tracks[SourceIndex].Positions;
+
+				// gaps in the slot track hold the last evaluated pose
+				if (!Animation)
+				{
+					Positions.Add(Positions.IsEmpty() ? FVector3f::ZeroVector : Positions.Last());
+					continue;
+				}
+
+				const FTransform BoneTransform = ComponentSpacePose.GetComponentSpaceTransform(BakeSources[SourceIndex].CompactIndex);
+				Positions.Add(FVector3f((BakeSources[SourceIndex].SocketLocal * BoneTransform).GetLocation()));
+			}
+		}
+	}
+
+	MarkPackageDirty();
+
+	return Sections.ContainsByPredicate([](const FCombatBakedSection& Section) { return !Section.Notifies.IsEmpty(); });
+}
+#endif
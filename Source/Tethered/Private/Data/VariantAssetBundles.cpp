@@ -0,0 +1,40 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Data/VariantAssetBundles.h"
+#include "Engine/AssetManager.h"
+
+const FPrimaryAssetType UVariantAssetBundles::PrimaryAssetType = TEXT("VariantAssetBundles");
+
+FPrimaryAssetId UVariantAssetBundles::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(PrimaryAssetType, GetFName());
+}
+
+TSharedPtr<FStreamableHandle> UVariantAssetBundles::LoadBundle(FName BundleName)
+{
+	UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+	if (!AssetManager || BundleName.IsNone())
+	{
+		return nullptr;
+	}
+
+	TArray<FPrimaryAssetId> AssetIds;
+	AssetManager->GetPrimaryAssetIdList(PrimaryAssetType, AssetIds);
+	if (AssetIds.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	return AssetManager->LoadPrimaryAssets(AssetIds, { BundleName });
+}
+
+TSharedPtr<FStreamableHandle> VariantAssets::RequestAsyncLoad(TArray<FSoftObjectPath> Paths)
+{
+	Paths.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull(); });
+	if (Paths.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	return UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(Paths));
+}
@@ -0,0 +1,255 @@
+// AimAssistReplayCommandlet.cpp
+#include "Debug/AimAssistReplayCommandlet.h"
+#include "Components/AimAssistRecorder.h"
+#include "Components/AimAssistScoring.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAimAssistReplay, Log, All);
+
+namespace
+{
+	/** Outcome of replaying a single query */
+	struct FReplayResult
+	{
+		uint32 ChosenTargetId = 0;
+		bool bHitUnknownLOS = false;
+	};
+
+	/** Replays one query through the same stage order as UAimAssistComponent::QueryForTarget */
+	FReplayResult ReplayQuery(const FAimAssistRecordedQuery& Query, uint32 CurrentTargetId, const FAimAssistScoreWeights& Weights,
+		float Stickiness, bool bScalar, FAimAssistCandidateSoA& SoA, TArray<int32>& Staged)
+	{
+		FReplayResult Result;
+
+		// score everything in range
+		SoA.Reset(Query.Candidates.Num());
+		for (const FAimAssistRecordedCandidate& Candidate : Query.Candidates)
+		{
+			SoA.Add(FVector(Candidate.Position.X, Candidate.Position.Y, 0.0), FVector(Candidate.Velocity.X, Candidate.Velocity.Y, 0.0), Candidate.ActorId == CurrentTargetId);
+		}
+
+		if (bScalar)
+		{
+			AimAssistScoring::ScoreCandidatesScalar(SoA, Query.Origin, Query.Forward, Weights);
+		}
+		else
+		{
+			AimAssistScoring::ScoreCandidates(SoA, Query.Origin, Query.Forward, Weights);
+		}
+
+		// FOV is re-evaluated; targetability can only come from the capture
+		Staged.Reset();
+		for (int32 i = 0; i < Query.Candidates.Num(); ++i)
+		{
+			if (SoA.Dist2D[i] <= KINDA_SMALL_NUMBER || SoA.Dot2D[i] < Query.MinFOVCos)
+			{
+				continue;
+			}
+
+			if (Query.Candidates[i].Stage == EAimAssistRecordedStage::RejectedTargetable)
+			{
+				continue;
+			}
+
+			Staged.Add(i);
+		}
+
+		Staged.Sort([&SoA](int32 A, int32 B) { return SoA.Score[A] > SoA.Score[B]; });
+
+		// top-K plus the current target, using LOS results from the capture
+		int32 Best = INDEX_NONE;
+		float BestScore = -FLT_MAX;
+		float CurrentScore = -FLT_MAX;
+
+		for (int32 i = 0; i < Staged.Num(); ++i)
+		{
+			const int32 Index = Staged[i];
+			const FAimAssistRecordedCandidate& Candidate = Query.Candidates[Index];
+			const bool bIsCurrent = Candidate.ActorId == CurrentTargetId;
+			if (i >= Query.MaxLineOfSightCandidates && !bIsCurrent)
+			{
+				continue;
+			}
+
+			// candidates that weren't traced live have no LOS result; count them as blocked
+			const bool bTraced = Candidate.Stage == EAimAssistRecordedStage::Selectable || Candidate.Stage == EAimAssistRecordedStage::RejectedLOS;
+			if (!bTraced)
+			{
+				Result.bHitUnknownLOS = true;
+				continue;
+			}
+
+			if (Candidate.Stage != EAimAssistRecordedStage::Selectable)
+			{
+				continue;
+			}
+
+			if (bIsCurrent)
+			{
+				CurrentScore = SoA.Score[Index];
+			}
+
+			if (SoA.Score[Index] > BestScore)
+			{
+				BestScore = SoA.Score[Index];
+				Best = Index;
+			}
+		}
+
+		Result.ChosenTargetId = Best != INDEX_NONE ? Query.Candidates[Best].ActorId : 0;
+
+		// same hysteresis as the live component
+		if (Best != INDEX_NONE && CurrentTargetId != 0 && Result.ChosenTargetId != CurrentTargetId && CurrentScore > -FLT_MAX)
+		{
+			if (AimAssistScoring::ShouldKeepCurrentTarget(BestScore, CurrentScore, Stickiness))
+			{
+				Result.ChosenTargetId = CurrentTargetId;
+			}
+		}
+
+		return Result;
+	}
+
+	/** Returns the value at the given percentile of a sorted sample list */
+	double Percentile(const TArray<double>& Sorted, double Fraction)
+	{
+		return Sorted.IsEmpty() ? 0.0 : Sorted[FMath::Clamp(FMath::FloorToInt32(Fraction * (Sorted.Num() - 1)), 0, Sorted.Num() - 1)];
+	}
+
+	/** Finds the most recently written capture in Saved/AimAssist */
+	FString FindNewestCapture()
+	{
+		const FString Dir = FPaths::ProjectSavedDir() / TEXT("AimAssist");
+
+		TArray<FString> Files;
+		IFileManager::Get().FindFiles(Files, *(Dir / TEXT("*.aarec")), true, false);
+
+		FString Newest;
+		FDateTime NewestTime = FDateTime::MinValue();
+		for (const FString& File : Files)
+		{
+			const FString Path = Dir / File;
+			const FDateTime Time = IFileManager::Get().GetTimeStamp(*Path);
+			if (Time > NewestTime)
+			{
+				NewestTime = Time;
+				Newest = Path;
+			}
+		}
+		return Newest;
+	}
+}
+
+UAimAssistReplayCommandlet::UAimAssistReplayCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UAimAssistReplayCommandlet::Main(const FString& Params)
+{
+	FString CapturePath;
+	if (!FParse::Value(*Params, TEXT("Capture="), CapturePath))
+	{
+		CapturePath = FindNewestCapture();
+	}
+
+	FAimAssistCapture Capture;
+	if (CapturePath.IsEmpty() || !FAimAssistRecorder::LoadFromFile(CapturePath, Capture))
+	{
+		UE_LOG(LogAimAssistReplay, Error, TEXT("Could not load aim assist capture '%s'"), *CapturePath);
+		return 1;
+	}
+
+	// alternate parameters; anything not provided keeps the recorded value
+	FAimAssistScoreWeights Weights = Capture.Weights;
+	FParse::Value(*Params, TEXT("WDist="), Weights.WDist);
+	FParse::Value(*Params, TEXT("WAngle="), Weights.WAngle);
+	FParse::Value(*Params, TEXT("WVel="), Weights.WVel);
+	FParse::Value(*Params, TEXT("WSticky="), Weights.WSticky);
+
+	float StickinessOverride = -1.f;
+	const bool bOverrideStickiness = FParse::Value(*Params, TEXT("Stickiness="), StickinessOverride);
+
+	int32 Iterations = 1;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(1, Iterations);
+
+	const bool bScalar = FParse::Param(*Params, TEXT("Scalar"));
+
+	const int32 NumQueries = Capture.Queries.Num();
+	UE_LOG(LogAimAssistReplay, Display, TEXT("Replaying %d queries from %s"), NumQueries, *CapturePath);
+	UE_LOG(LogAimAssistReplay, Display, TEXT("  Weights: WDist %.3f WAngle %.3f WVel %.3f WSticky %.3f | Stickiness %s | %s kernel | %d iterations"),
+		Weights.WDist, Weights.WAngle, Weights.WVel, Weights.WSticky,
+		bOverrideStickiness ? *FString::SanitizeFloat(StickinessOverride) : TEXT("recorded"),
+		bScalar ? TEXT("scalar") : TEXT("SIMD"), Iterations);
+
+	if (NumQueries == 0)
+	{
+		return 0;
+	}
+
+	FAimAssistCandidateSoA SoA;
+	TArray<int32> Staged;
+
+	TArray<double> ReplayMicros;
+	ReplayMicros.Init(0.0, NumQueries);
+
+	int32 Agreements = 0;
+	int32 UnknownLOS = 0;
+	int32 ReplaySwitches = 0;
+	int32 RecordedSwitches = 0;
+
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		// the replay keeps its own target so hysteresis follows the alternate parameters
+		uint32 CurrentTargetId = Capture.Queries[0].PreviousTargetId;
+
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+		{
+			const FAimAssistRecordedQuery& Query = Capture.Queries[QueryIndex];
+			const float Stickiness = bOverrideStickiness ? StickinessOverride : Query.Stickiness;
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			const FReplayResult Result = ReplayQuery(Query, CurrentTargetId, Weights, Stickiness, bScalar, SoA, Staged);
+			ReplayMicros[QueryIndex] += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0;
+
+			// decision stats only need one pass
+			if (Iteration == 0)
+			{
+				Agreements += Result.ChosenTargetId == Query.ChosenTargetId ? 1 : 0;
+				UnknownLOS += Result.bHitUnknownLOS ? 1 : 0;
+				ReplaySwitches += Result.ChosenTargetId != CurrentTargetId ? 1 : 0;
+				RecordedSwitches += Query.ChosenTargetId != Query.PreviousTargetId ? 1 : 0;
+			}
+
+			CurrentTargetId = Result.ChosenTargetId;
+		}
+	}
+
+	// per-query averages across iterations, then distribution
+	TArray<double> LiveMillis;
+	LiveMillis.Reserve(NumQueries);
+	double ReplayTotal = 0.0;
+	for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+	{
+		ReplayMicros[QueryIndex] /= Iterations;
+		ReplayTotal += ReplayMicros[QueryIndex];
+		LiveMillis.Add(Capture.Queries[QueryIndex].QueryMs);
+	}
+	ReplayMicros.Sort();
+	LiveMillis.Sort();
+
+	UE_LOG(LogAimAssistReplay, Display, TEXT("Decisions: %.1f%% agree with recorded (%d/%d), switches %d replay vs %d recorded, %d queries needed untraced LOS"),
+		100.0 * Agreements / NumQueries, Agreements, NumQueries, ReplaySwitches, RecordedSwitches, UnknownLOS);
+	UE_LOG(LogAimAssistReplay, Display, TEXT("Replay selection (us/query): mean %.2f p50 %.2f p95 %.2f max %.2f"),
+		ReplayTotal / NumQueries, Percentile(ReplayMicros, 0.5), Percentile(ReplayMicros, 0.95), ReplayMicros.Last());
+	UE_LOG(LogAimAssistReplay, Display, TEXT("Recorded live selection (ms/query): p50 %.3f p95 %.3f max %.3f"),
+		Percentile(LiveMillis, 0.5), Percentile(LiveMillis, 0.95), LiveMillis.Last());
+
+	return 0;
+}
@@ -0,0 +1,159 @@
+// CombatMontageBakeCommandlet.cpp
+#include "Debug/CombatMontageBakeCommandlet.h"
+#include "Data/CombatMontageBake.h"
+#include "Animation/AnimMontage.h"
+#include "Animation/Skeleton.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/SkeletalMesh.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCombatMontageBake, Log, All);
+
+UCombatMontageBakeCommandlet::UCombatMontageBakeCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+#if WITH_EDITOR
+namespace
+{
+	/** Bakes one montage and saves the result next to it. Returns false on failure */
+	bool BakeMontage(UAnimMontage& Montage, USkeletalMesh* MeshOverride, float SampleRate, bool bRequireNotifies)
+	{
+		USkeletalMesh* Mesh = MeshOverride;
+		if (!Mesh && Montage.GetSkeleton())
+		{
+			Mesh = Montage.GetSkeleton()->GetPreviewMesh(true);
+		}
+
+		if (!Mesh)
+		{
+			UE_LOG(LogCombatMontageBake, Error, TEXT("%s: no mesh to evaluate on, pass -Mesh= or set a skeleton preview mesh"), *Montage.GetPathName());
+			return false;
+		}
+
+		const FString PackageName = FPackageName::GetLongPackagePath(Montage.GetPackage()->GetName()) / (Montage.GetName() + TEXT("_Bake"));
+		UPackage* Package = CreatePackage(*PackageName);
+		Package->FullyLoad();
+
+		const FName AssetName = FName(*FPackageName::GetShortName(PackageName));
+		UCombatMontageBake* Bake = FindObject<UCombatMontageBake>(Package, *AssetName.ToString());
+		const bool bCreated = Bake == nullptr;
+		if (bCreated)
+		{
+			Bake = NewObject<UCombatMontageBake>(Package, AssetName, RF_Public | RF_Standalone);
+		}
+
+		if (!Bake->BakeFrom(&Montage, Mesh, SampleRate))
+		{
+			// montages without combat notifies are skipped quietly during a full scan
+			if (bRequireNotifies)
+			{
+				UE_LOG(LogCombatMontageBake, Error, TEXT("%s: no combat notifies found"), *Montage.GetPathName());
+			}
+
+			if (bCreated)
+			{
+				Bake->ClearFlags(RF_Public | RF_Standalone);
+				Bake->MarkAsGarbage();
+			}
+			return false;
+		}
+
+		if (bCreated)
+		{
+			IAssetRegistry::GetChecked().AssetCreated(Bake);
+		}
+
+		const FString Filename = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		if (!UPackage::SavePackage(Package, Bake, *Filename, SaveArgs))
+		{
+			UE_LOG(LogCombatMontageBake, Error, TEXT("%s: failed to save %s"), *Montage.GetPathName(), *Filename);
+			return false;
+		}
+
+		int32 NumNotifies = 0;
+		for (const FCombatBakedSection& Section : Bake->Sections)
+		{
+			NumNotifies += Section.Notifies.Num();
+		}
+
+		UE_LOG(LogCombatMontageBake, Display, TEXT("%s -> %s (%d sections, %d events, %.0f Hz, mesh %s)"),
+			*Montage.GetName(), *Bake->GetPathName(), Bake->Sections.Num(), NumNotifies, SampleRate, *Mesh->GetName());
+		return true;
+	}
+}
+#endif
+
+int32 UCombatMontageBakeCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+	float SampleRate = 30.f;
+	FParse::Value(*Params, TEXT("SampleRate="), SampleRate);
+	if (SampleRate <= 0.f)
+	{
+		UE_LOG(LogCombatMontageBake, Error, TEXT("SampleRate must be positive"));
+		return 1;
+	}
+
+	USkeletalMesh* MeshOverride = nullptr;
+	FString MeshPath;
+	if (FParse::Value(*Params, TEXT("Mesh="), MeshPath))
+	{
+		MeshOverride = LoadObject<USkeletalMesh>(nullptr, *MeshPath);
+		if (!MeshOverride)
+		{
+			UE_LOG(LogCombatMontageBake, Error, TEXT("Could not load skeletal mesh '%s'"), *MeshPath);
+			return 1;
+		}
+	}
+
+	// a single montage
+	FString MontagePath;
+	if (FParse::Value(*Params, TEXT("Montage="), MontagePath))
+	{
+		UAnimMontage* Montage = LoadObject<UAnimMontage>(nullptr, *MontagePath);
+		if (!Montage)
+		{
+			UE_LOG(LogCombatMontageBake, Error, TEXT("Could not load montage '%s'"), *MontagePath);
+			return 1;
+		}
+
+		return BakeMontage(*Montage, MeshOverride, SampleRate, true) ? 0 : 1;
+	}
+
+	// every project montage; the ones without combat notifies produce nothing
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	AssetRegistry.SearchAllAssets(true);
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByPath(TEXT("/Game"), Assets, true);
+
+	int32 NumBaked = 0;
+	for (const FAssetData& Asset : Assets)
+	{
+		if (Asset.AssetClassPath != UAnimMontage::StaticClass()->GetClassPathName())
+		{
+			continue;
+		}
+
+		if (UAnimMontage* Montage = Cast<UAnimMontage>(Asset.GetAsset()))
+		{
+			NumBaked += BakeMontage(*Montage, MeshOverride, SampleRate, false) ? 1 : 0;
+		}
+	}
+
+	UE_LOG(LogCombatMontageBake, Display, TEXT("Baked %d montages. Assign the bakes to ComboAttackBake / ChargedAttackBake on the character Blueprints"), NumBaked);
+	return 0;
+#else
+	UE_LOG(LogCombatMontageBake, Error, TEXT("Montage baking needs editor data"));
+	return 1;
+#endif
+}
@@ -2,6 +2,10 @@
 #include "Debug/TetheredCheatManager.h"
 #include "Components/AimAssistComponent.h"
 #include "Components/CombatComponent.h"
+#include "Subsystems/AimAssistSolverSubsystem.h"
+#include "Subsystems/HurtboxRegistrySubsystem.h"
+#include "Subsystems/RagdollBudgetSubsystem.h"
+#include "Subsystems/CombatSpawnSchedulerSubsystem.h"
 #include "Character/TetheredCharacter.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/Engine.h"
@@ -153,6 +157,98 @@ void UTetheredCheatManager::ClearForcedAimAssistTarget()
 	// TODO: Implement clearing forced targeting if needed
 }
 
+void UTetheredCheatManager::ToggleAimAssistRecording()
+{
+	UAimAssistComponent* AimAssist = GetPlayerAimAssistComponent();
+	if (!AimAssist)
+	{
+		UE_LOG(LogTetheredCheat, Warning, TEXT("ToggleAimAssistRecording: no aim assist component"));
+		return;
+	}
+	
+	FString StatusText;
+	if (AimAssist->IsRecordingDecisions())
+	{
+		const FString Filename = AimAssist->StopDecisionRecording();
+		StatusText = Filename.IsEmpty() ? TEXT("Aim Assist Recording: FAILED TO SAVE") : FString::Printf(TEXT("Aim Assist Recording saved: %s"), *Filename);
+	}
+	else
+	{
+		AimAssist->StartDecisionRecording();
+		StatusText = TEXT("Aim Assist Recording: STARTED");
+	}
+	
+	UE_LOG(LogTetheredCheat, Log, TEXT("%s"), *StatusText);
+	
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Cyan, StatusText);
+	}
+}
+
+void UTetheredCheatManager::ToggleAimAssistVisibilityGrid()
+{
+	UAimAssistSolverSubsystem::bVisibilityGridEnabled = !UAimAssistSolverSubsystem::bVisibilityGridEnabled;
+	
+	const FString StatusText = UAimAssistSolverSubsystem::bVisibilityGridEnabled ? TEXT("ENABLED") : TEXT("DISABLED");
+	UE_LOG(LogTetheredCheat, Log, TEXT("Aim Assist Visibility Grid: %s"), *StatusText);
+	
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, 
+			UAimAssistSolverSubsystem::bVisibilityGridEnabled ? FColor::Green : FColor::Red,
+			FString::Printf(TEXT("Aim Assist Visibility Grid: %s"), *StatusText));
+	}
+}
+
+void UTetheredCheatManager::ToggleHurtboxRegistry()
+{
+	UHurtboxRegistrySubsystem::bRegistryEnabled = !UHurtboxRegistrySubsystem::bRegistryEnabled;
+	
+	const FString StatusText = UHurtboxRegistrySubsystem::bRegistryEnabled ? TEXT("ENABLED") : TEXT("DISABLED");
+	UE_LOG(LogTetheredCheat, Log, TEXT("Hurtbox Registry: %s"), *StatusText);
+	
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, 
+			UHurtboxRegistrySubsystem::bRegistryEnabled ? FColor::Green : FColor::Red,
+			FString::Printf(TEXT("Hurtbox Registry: %s"), *StatusText));
+	}
+}
+
+void UTetheredCheatManager::SetRagdollBudget(int32 MaxActiveRagdolls)
+{
+	URagdollBudgetSubsystem::MaxActiveRagdolls = FMath::Max(MaxActiveRagdolls, 0);
+	
+	int32 NumActive = 0;
+	if (const URagdollBudgetSubsystem* RagdollBudget = GetWorld()->GetSubsystem<URagdollBudgetSubsystem>())
+	{
+		NumActive = RagdollBudget->GetNumActiveRagdolls();
+	}
+	
+	UE_LOG(LogTetheredCheat, Log, TEXT("Ragdoll Budget: %d (active: %d)"), URagdollBudgetSubsystem::MaxActiveRagdolls, NumActive);
+	
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Cyan,
+			FString::Printf(TEXT("Ragdoll Budget: %d (active: %d)"), URagdollBudgetSubsystem::MaxActiveRagdolls, NumActive));
+	}
+}
+
+void UTetheredCheatManager::SetSpawnBudget(int32 MaxSpawnsPerFrame, float BudgetMs)
+{
+	UCombatSpawnSchedulerSubsystem::MaxSpawnsPerFrame = FMath::Max(MaxSpawnsPerFrame, 1);
+	UCombatSpawnSchedulerSubsystem::SpawnBudgetMs = FMath::Max(BudgetMs, 0.0f);
+	
+	UE_LOG(LogTetheredCheat, Log, TEXT("Spawn Budget: %d per frame, %.2f ms"), UCombatSpawnSchedulerSubsystem::MaxSpawnsPerFrame, UCombatSpawnSchedulerSubsystem::SpawnBudgetMs);
+	
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Cyan,
+			FString::Printf(TEXT("Spawn Budget: %d per frame, %.2f ms"), UCombatSpawnSchedulerSubsystem::MaxSpawnsPerFrame, UCombatSpawnSchedulerSubsystem::SpawnBudgetMs));
+	}
+}
+
 #pragma endregion Combat Debug Commands
 
 #pragma region Utility Commands
@@ -167,11 +263,16 @@ void UTetheredCheatManager::ListTetheredCommands()
 		TEXT("ShowAimAssistStatus - Show aim assist component status"),
 		TEXT("ForceAimAssistTarget <ActorName> - Force target (WIP)"),
 		TEXT("ClearForcedAimAssistTarget - Clear forced target (WIP)"),
+		TEXT("ToggleAimAssistRecording - Start/stop recording decisions for replay"),
+		TEXT("ToggleAimAssistVisibilityGrid - Toggle baked LOS grids (off = always trace)"),
 		TEXT(""),
 		TEXT("=== COMBAT COMMANDS ==="),
 		TEXT("ShowCombatDebug <true/false> - Show combat debug traces"),
 		TEXT("ToggleCombatDebug - Toggle combat debug traces"),
 		TEXT("ShowCombatStatus - Show combat component status"),
+		TEXT("ToggleHurtboxRegistry - Toggle hurtbox registry (off = physics sweeps)"),
+		TEXT("SetRagdollBudget <Count> - Set max simulating ragdolls"),
+		TEXT("SetSpawnBudget <Count> <Ms> - Set per-frame enemy spawn budget"),
 		TEXT(""),
 		TEXT("=== UTILITY COMMANDS ==="),
 		TEXT("ListTetheredCommands - Show this list")
@@ -4,5 +4,5 @@
 
 ACombatGameMode::ACombatGameMode()
 {
-
-}
\ No newline at end of file
+	AssetBundle = TEXT("Combat");
+}
@@ -4,5 +4,5 @@
 
 APlatformingGameMode::APlatformingGameMode()
 {
-	// stub
-}
\ No newline at end of file
+	AssetBundle = TEXT("Platforming");
+}
@@ -6,6 +6,11 @@
 #include "UI/SideScrollingUI.h"
 #include "Gameplay/SideScrollingPickup.h"
 
+ASideScrollingGameMode::ASideScrollingGameMode()
+{
+	AssetBundle = TEXT("SideScrolling");
+}
+
 void ASideScrollingGameMode::BeginPlay()
 {
 	Super::BeginPlay();
@@ -16,6 +21,9 @@ void ASideScrollingGameMode::BeginPlay()
 	UserInterface = CreateWidget<USideScrollingUI>(OwningPlayer, UserInterfaceClass);
 
 	check(UserInterface);
+
+	// the pickup counter is pushed to the UI through its view model
+	PickupsViewModel.Bind(UserInterface);
 }
 
 void ASideScrollingGameMode::ProcessPickup()
@@ -29,6 +37,6 @@ void ASideScrollingGameMode::ProcessPickup()
 		UserInterface->AddToViewport(0);
 	}
 
-	// update the pickups counter on the UI
-	UserInterface->UpdatePickups(PickupsCollected);
+	// update the pickups counter on the UI; a burst of pickups in one frame costs a single update
+	PickupsViewModel.SetPickups(PickupsCollected);
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Game/TetheredGameMode.h"
+#include "Data/VariantAssetBundles.h"
+
+void ATetheredGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
+
+	// bring in this variant's montages and classes in the background
+	AssetBundleHandle = UVariantAssetBundles::LoadBundle(AssetBundle);
+}
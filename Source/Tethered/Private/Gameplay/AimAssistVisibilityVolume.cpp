@@ -0,0 +1,434 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Gameplay/AimAssistVisibilityVolume.h"
+#include "Subsystems/AimAssistSolverSubsystem.h"
+#include "Components/BoxComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "Misc/ScopedSlowTask.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAimAssistVisibility, Log, All);
+
+AAimAssistVisibilityVolume::AAimAssistVisibilityVolume()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	// create the box volume
+	RootComponent = Box = CreateDefaultSubobject<UBoxComponent>(TEXT("Box"));
+	check(Box);
+
+	// set the box's extent
+	Box->SetBoxExtent(FVector(1000.0f, 1000.0f, 500.0f));
+
+	// the box only marks the grid bounds, it never collides
+	Box->SetCollisionProfileName(FName("NoCollision"));
+}
+
+void AAimAssistVisibilityVolume::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!HasBakedData())
+	{
+		UE_LOG(LogAimAssistVisibility, Warning, TEXT("%s has no baked visibility grid, aim assist will trace every LOS check"), *GetName());
+		return;
+	}
+
+	// collect the movable geometry that can occlude the baked channel. Pawns are left out, since aim assist
+	// targets are pawns and the baked answer is about the arena, not about who stands in front of whom
+	TArray<FOverlapResult> Overlaps;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AimAssistVisibilityBlockers), false, this);
+	GetWorld()->OverlapMultiByObjectType(Overlaps, Box->GetComponentLocation(), Box->GetComponentQuat(),
+		FCollisionObjectQueryParams(FCollisionObjectQueryParams::AllDynamicObjects), Box->GetCollisionShape(), QueryParams);
+
+	for (const FOverlapResult& Overlap : Overlaps)
+	{
+		if (!Cast<APawn>(Overlap.GetActor()))
+		{
+			AddDynamicBlocker(Overlap.GetComponent());
+		}
+	}
+
+	DynamicCells.Init(false, NumCellsX * NumCellsY);
+
+	// movable blockers spawned later, like breakable props or doors, are picked up as they appear
+	ActorSpawnedHandle = GetWorld()->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &AAimAssistVisibilityVolume::OnActorSpawned));
+
+	if (UAimAssistSolverSubsystem* Solver = GetWorld()->GetSubsystem<UAimAssistSolverSubsystem>())
+	{
+		Solver->RegisterVisibilityVolume(this);
+	}
+}
+
+void AAimAssistVisibilityVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	GetWorld()->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	ActorSpawnedHandle.Reset();
+
+	if (UAimAssistSolverSubsystem* Solver = GetWorld()->GetSubsystem<UAimAssistSolverSubsystem>())
+	{
+		Solver->UnregisterVisibilityVolume(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAimAssistVisibilityVolume::AddDynamicBlocker(UPrimitiveComponent* Blocker)
+{
+	// only movable components that actually block the baked channel can invalidate a baked answer
+	if (!IsValid(Blocker) || Blocker->Mobility == EComponentMobility::Static
+		|| Blocker->GetCollisionResponseToChannel(BakedChannel) != ECR_Block)
+	{
+		return;
+	}
+
+	DynamicBlockers.AddUnique(Blocker);
+
+	// force a refresh on the next query
+	DynamicCellsFrame = 0;
+}
+
+void AAimAssistVisibilityVolume::OnActorSpawned(AActor* SpawnedActor)
+{
+	// pawns are left out for the same reason as in BeginPlay
+	if (!IsValid(SpawnedActor) || Cast<APawn>(SpawnedActor))
+	{
+		return;
+	}
+
+	// blockers outside the grid are harmless; their bounds never mark a cell
+	TInlineComponentArray<UPrimitiveComponent*> Primitives(SpawnedActor);
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		AddDynamicBlocker(Primitive);
+	}
+}
+
+EAimAssistBakedVisibility AAimAssistVisibilityVolume::QueryVisibility(const FVector& From, const FVector& To, ECollisionChannel Channel)
+{
+	if (!HasBakedData() || Channel != BakedChannel)
+	{
+		return EAimAssistBakedVisibility::Unknown;
+	}
+
+	const int32 FromCell = GetCellIndex(From);
+	const int32 ToCell = GetCellIndex(To);
+	if (FromCell == INDEX_NONE || ToCell == INDEX_NONE || !CellHasFloor[FromCell] || !CellHasFloor[ToCell])
+	{
+		return EAimAssistBakedVisibility::Unknown;
+	}
+
+	// the grid only sampled a band of heights above each floor; endpoints outside it, like on another level
+	// of the arena, need a real trace
+	const float FromHeight = From.Z - CellFloorZ[FromCell];
+	const float ToHeight = To.Z - CellFloorZ[ToCell];
+	if (FromHeight < BakedHeightRange.X || FromHeight > BakedHeightRange.Y || ToHeight < BakedHeightRange.X || ToHeight > BakedHeightRange.Y)
+	{
+		return EAimAssistBakedVisibility::Unknown;
+	}
+
+	const EAimAssistBakedVisibility Baked = GetPair(FromCell, ToCell);
+
+	// a dynamic blocker can only turn a clear segment into a blocked one
+	if (Baked == EAimAssistBakedVisibility::Visible)
+	{
+		RefreshDynamicCells();
+		if (SegmentTouchesDynamicCell(From, To))
+		{
+			return EAimAssistBakedVisibility::Unknown;
+		}
+	}
+
+	return Baked;
+}
+
+int32 AAimAssistVisibilityVolume::GetCellIndex(const FVector& Location) const
+{
+	const int32 X = FMath::FloorToInt32((Location.X - GridOrigin.X) / BakedCellSize);
+	const int32 Y = FMath::FloorToInt32((Location.Y - GridOrigin.Y) / BakedCellSize);
+	if (X < 0 || Y < 0 || X >= NumCellsX || Y >= NumCellsY)
+	{
+		return INDEX_NONE;
+	}
+	return Y * NumCellsX + X;
+}
+
+FVector2D AAimAssistVisibilityVolume::GetCellCenter(int32 Cell) const
+{
+	const double X = (Cell % NumCellsX) + 0.5;
+	const double Y = (Cell / NumCellsX) + 0.5;
+	return GridOrigin + FVector2D(X, Y) * BakedCellSize;
+}
+
+int64 AAimAssistVisibilityVolume::GetPairBit(int32 CellA, int32 CellB) const
+{
+	// pairs are unordered, so only the upper triangle (including the diagonal) is stored
+	const int64 Lo = FMath::Min(CellA, CellB);
+	const int64 Hi = FMath::Max(CellA, CellB);
+	const int64 NumCells = static_cast<int64>(NumCellsX) * NumCellsY;
+	const int64 PairIndex = Lo * NumCells - (Lo * (Lo - 1)) / 2 + (Hi - Lo);
+	return PairIndex * 2;
+}
+
+EAimAssistBakedVisibility AAimAssistVisibilityVolume::GetPair(int32 CellA, int32 CellB) const
+{
+	const int64 Bit = GetPairBit(CellA, CellB);
+	return static_cast<EAimAssistBakedVisibility>((PairVisibility[Bit >> 3] >> (Bit & 7)) & 0x3);
+}
+
+void AAimAssistVisibilityVolume::RefreshDynamicCells()
+{
+	if (DynamicCellsFrame == GFrameCounter)
+	{
+		return;
+	}
+	DynamicCellsFrame = GFrameCounter;
+
+	DynamicCells.SetRange(0, DynamicCells.Num(), false);
+
+	for (int32 Index = DynamicBlockers.Num() - 1; Index >= 0; --Index)
+	{
+		const UPrimitiveComponent* Blocker = DynamicBlockers[Index].Get();
+		if (!Blocker)
+		{
+			DynamicBlockers.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		// skip blockers that stopped colliding, e.g. destroyed boxes waiting for cleanup
+		if (!Blocker->IsCollisionEnabled())
+		{
+			continue;
+		}
+
+		// mark every cell the blocker's bounds overlap
+		const FBox Bounds = Blocker->Bounds.GetBox();
+		const int32 MinX = FMath::Max(FMath::FloorToInt32((Bounds.Min.X - GridOrigin.X) / BakedCellSize), 0);
+		const int32 MinY = FMath::Max(FMath::FloorToInt32((Bounds.Min.Y - GridOrigin.Y) / BakedCellSize), 0);
+		const int32 MaxX = FMath::Min(FMath::FloorToInt32((Bounds.Max.X - GridOrigin.X) / BakedCellSize), NumCellsX - 1);
+		const int32 MaxY = FMath::Min(FMath::FloorToInt32((Bounds.Max.Y - GridOrigin.Y) / BakedCellSize), NumCellsY - 1);
+
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			for (int32 X = MinX; X <= MaxX; ++X)
+			{
+				DynamicCells[Y * NumCellsX + X] = true;
+			}
+		}
+	}
+}
+
+bool AAimAssistVisibilityVolume::SegmentTouchesDynamicCell(const FVector& From, const FVector& To) const
+{
+	if (DynamicBlockers.IsEmpty())
+	{
+		return false;
+	}
+
+	// walk the segment in quarter cell steps, which is enough to catch every cell it crosses but the corners
+	const FVector2D Start(From);
+	const FVector2D Delta = FVector2D(To) - Start;
+	const int32 NumSteps = FMath::Max(FMath::CeilToInt32(Delta.Size() / (BakedCellSize * 0.25f)), 1);
+
+	for (int32 Step = 0; Step <= NumSteps; ++Step)
+	{
+		const FVector2D Point = Start + Delta * (static_cast<float>(Step) / NumSteps);
+		const int32 Cell = GetCellIndex(FVector(Point, 0.0));
+		if (Cell != INDEX_NONE && DynamicCells[Cell])
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+#if WITH_EDITOR
+
+void AAimAssistVisibilityVolume::SetPair(int32 CellA, int32 CellB, EAimAssistBakedVisibility Value)
+{
+	const int64 Bit = GetPairBit(CellA, CellB);
+	uint8& Byte = PairVisibility[Bit >> 3];
+	Byte = (Byte & ~(0x3 << (Bit & 7))) | (static_cast<uint8>(Value) << (Bit & 7));
+}
+
+EAimAssistBakedVisibility AAimAssistVisibilityVolume::TraceStatic(const FVector& From, const FVector& To, FHitResult* OutHit) const
+{
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AimAssistVisibilityBake), false, this);
+
+	// movable geometry is handled at runtime, so step through it until static geometry or nothing is hit
+	for (int32 Attempt = 0; Attempt < 8; ++Attempt)
+	{
+		FHitResult Hit;
+		if (!GetWorld()->LineTraceSingleByChannel(Hit, From, To, BakedChannel, QueryParams))
+		{
+			return EAimAssistBakedVisibility::Visible;
+		}
+
+		const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+		if (!HitComponent || HitComponent->Mobility == EComponentMobility::Static)
+		{
+			if (OutHit)
+			{
+				*OutHit = Hit;
+			}
+			return EAimAssistBakedVisibility::Blocked;
+		}
+
+		QueryParams.AddIgnoredComponent(HitComponent);
+	}
+
+	return EAimAssistBakedVisibility::Unknown;
+}
+
+void AAimAssistVisibilityVolume::BakeVisibility()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const FBox Bounds = Box->Bounds.GetBox();
+	const int32 NewNumX = FMath::Max(FMath::CeilToInt32(Bounds.GetSize().X / CellSize), 1);
+	const int32 NewNumY = FMath::Max(FMath::CeilToInt32(Bounds.GetSize().Y / CellSize), 1);
+	const int32 NumCells = NewNumX * NewNumY;
+
+	if (NumCells > MaxCells)
+	{
+		UE_LOG(LogAimAssistVisibility, Error, TEXT("%s: %d x %d cells exceeds MaxCells (%d). Increase CellSize or shrink the box."),
+			*GetName(), NewNumX, NewNumY, MaxCells);
+		return;
+	}
+
+	Modify();
+
+	NumCellsX = NewNumX;
+	NumCellsY = NewNumY;
+	GridOrigin = FVector2D(Bounds.Min);
+	BakedCellSize = CellSize;
+	BakedChannel = BakeChannel;
+	BakedHeightRange = FVector2f(MinSampleHeight, FMath::Max(MaxSampleHeight, MinSampleHeight));
+
+	const int64 NumPairs = static_cast<int64>(NumCells) * (NumCells + 1) / 2;
+	PairVisibility.Init(0, static_cast<int32>((NumPairs * 2 + 7) / 8));
+	CellFloorZ.Init(0.0f, NumCells);
+	CellHasFloor.Init(false, NumCells);
+
+	FScopedSlowTask SlowTask(static_cast<float>(NumCells * 2), FText::FromString(TEXT("Baking aim assist visibility grid")));
+	SlowTask.MakeDialog(true);
+
+	// find the floor under every cell center
+	for (int32 Cell = 0; Cell < NumCells; ++Cell)
+	{
+		SlowTask.EnterProgressFrame();
+
+		const FVector2D Center = GetCellCenter(Cell);
+		FHitResult FloorHit;
+		if (TraceStatic(FVector(Center, Bounds.Max.Z), FVector(Center, Bounds.Min.Z), &FloorHit) == EAimAssistBakedVisibility::Blocked)
+		{
+			CellFloorZ[Cell] = FloorHit.ImpactPoint.Z;
+			CellHasFloor[Cell] = true;
+		}
+	}
+
+	// sample the center and four inset points of each cell
+	const float Inset = BakedCellSize * 0.3f;
+	const FVector2D SampleOffsets[] = { { 0.0, 0.0 }, { -Inset, -Inset }, { Inset, -Inset }, { -Inset, Inset }, { Inset, Inset } };
+	const float MaxBakeDistanceSq = FMath::Square(MaxBakeDistance);
+
+	// heights spread evenly over the band runtime endpoints are accepted in, so low cover and overhangs
+	// inside the band split the samples instead of going unnoticed
+	TArray<float, TInlineAllocator<5>> SampleHeights;
+	for (int32 Level = 0; Level < NumSampleHeights; ++Level)
+	{
+		SampleHeights.Add(FMath::Lerp(BakedHeightRange.X, BakedHeightRange.Y, static_cast<float>(Level) / (NumSampleHeights - 1)));
+	}
+
+	// a pair is only decided when every sample agrees, from every height at one end to every height at the other.
+	// partial occlusion stays unknown, and the first disagreement ends the pair
+	auto ClassifyPair = [&](int32 CellA, int32 CellB)
+	{
+		const FVector2D CenterA = GetCellCenter(CellA);
+		const FVector2D CenterB = GetCellCenter(CellB);
+		EAimAssistBakedVisibility Agreed = EAimAssistBakedVisibility::Unknown;
+
+		for (const FVector2D& Offset : SampleOffsets)
+		{
+			for (const float HeightA : SampleHeights)
+			{
+				for (const float HeightB : SampleHeights)
+				{
+					const EAimAssistBakedVisibility Sample = TraceStatic(FVector(CenterA + Offset, CellFloorZ[CellA] + HeightA), FVector(CenterB + Offset, CellFloorZ[CellB] + HeightB));
+					if (Sample == EAimAssistBakedVisibility::Unknown || (Agreed != EAimAssistBakedVisibility::Unknown && Sample != Agreed))
+					{
+						return EAimAssistBakedVisibility::Unknown;
+					}
+					Agreed = Sample;
+				}
+			}
+		}
+
+		return Agreed;
+	};
+
+	int32 NumVisible = 0;
+	int32 NumBlocked = 0;
+
+	for (int32 CellA = 0; CellA < NumCells; ++CellA)
+	{
+		SlowTask.EnterProgressFrame();
+		if (SlowTask.ShouldCancel())
+		{
+			ClearVisibility();
+			return;
+		}
+
+		if (!CellHasFloor[CellA])
+		{
+			continue;
+		}
+
+		const FVector2D CenterA = GetCellCenter(CellA);
+
+		for (int32 CellB = CellA; CellB < NumCells; ++CellB)
+		{
+			if (!CellHasFloor[CellB])
+			{
+				continue;
+			}
+
+			const FVector2D CenterB = GetCellCenter(CellB);
+			if (FVector2D::DistSquared(CenterA, CenterB) > MaxBakeDistanceSq)
+			{
+				continue;
+			}
+
+			const EAimAssistBakedVisibility Value = ClassifyPair(CellA, CellB);
+			if (Value != EAimAssistBakedVisibility::Unknown)
+			{
+				SetPair(CellA, CellB, Value);
+				NumVisible += Value == EAimAssistBakedVisibility::Visible ? 1 : 0;
+				NumBlocked += Value == EAimAssistBakedVisibility::Blocked ? 1 : 0;
+			}
+		}
+	}
+
+	UE_LOG(LogAimAssistVisibility, Log, TEXT("%s: baked %d x %d cells, %lld pairs (%d visible, %d blocked, rest unknown), %d bytes"),
+		*GetName(), NumCellsX, NumCellsY, NumPairs, NumVisible, NumBlocked, PairVisibility.Num());
+}
+
+void AAimAssistVisibilityVolume::ClearVisibility()
+{
+	Modify();
+
+	NumCellsX = 0;
+	NumCellsY = 0;
+	BakedCellSize = 0.0f;
+	PairVisibility.Empty();
+	CellFloorZ.Empty();
+	CellHasFloor.Empty();
+}
+
+#endif
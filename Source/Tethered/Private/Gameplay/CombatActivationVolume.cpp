@@ -21,6 +21,43 @@ ACombatActivationVolume::ACombatActivationVolume()
 
 	// bind the begin overlap 
 	Box->OnComponentBeginOverlap.AddDynamic(this, &ACombatActivationVolume::OnOverlap);
+
+	// create the prefetch box; it only needs to notice pawns
+	PrefetchBox = CreateDefaultSubobject<UBoxComponent>(TEXT("PrefetchBox"));
+	PrefetchBox->SetupAttachment(RootComponent);
+	PrefetchBox->SetCollisionProfileName(FName("OverlapOnlyPawn"));
+	PrefetchBox->SetCanEverAffectNavigation(false);
+	PrefetchBox->OnComponentBeginOverlap.AddDynamic(this, &ACombatActivationVolume::OnPrefetchOverlap);
+}
+
+void ACombatActivationVolume::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	// grow the prefetch box past the activation box by the prefetch distance, in world units
+	const FVector Scale = GetActorScale3D().GetAbs().ComponentMax(FVector(UE_KINDA_SMALL_NUMBER));
+	PrefetchBox->SetBoxExtent(Box->GetUnscaledBoxExtent() + FVector(PrefetchDistance) / Scale);
+}
+
+void ACombatActivationVolume::OnPrefetchOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	// only prefetch once, and only for player characters
+	const ACharacter* PlayerCharacter = Cast<ACharacter>(OtherActor);
+	if (bHasPrefetched || !PlayerCharacter || !PlayerCharacter->IsPlayerControlled())
+	{
+		return;
+	}
+
+	bHasPrefetched = true;
+
+	// let the actors we'll activate start loading their content
+	for (AActor* CurrentActor : ActorsToActivate)
+	{
+		if (ICombatActivatable* Activatable = Cast<ICombatActivatable>(CurrentActor))
+		{
+			Activatable->PrefetchInteraction(OtherActor);
+		}
+	}
 }
 
 void ACombatActivationVolume::OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
@@ -4,6 +4,8 @@
 #include "Components/StaticMeshComponent.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
+#include "Gameplay/CombatCollision.h"
+#include "Subsystems/HurtboxRegistrySubsystem.h"
 
 ACombatDamageableBox::ACombatDamageableBox()
 {
@@ -12,8 +14,8 @@ ACombatDamageableBox::ACombatDamageableBox()
 	// create the mesh
 	RootComponent = Mesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Mesh"));
 
-	// set the collision properties
-	Mesh->SetCollisionProfileName(FName("BlockAllDynamic"));
+	// set the collision properties; damageable props are simulating bodies found by player attacks
+	Mesh->SetCollisionProfileName(CombatCollision::DamageablePropProfile);
 
 	// enable physics
 	Mesh->SetSimulatePhysics(true);
@@ -28,10 +30,26 @@ void ACombatDamageableBox::RemoveFromLevel()
 	Destroy();
 }
 
+void ACombatDamageableBox::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// make the box visible to player attacks
+	if (UHurtboxRegistrySubsystem* HurtboxRegistry = GetWorld()->GetSubsystem<UHurtboxRegistrySubsystem>())
+	{
+		HurtboxRegistry->RegisterHurtbox(Mesh, EHurtboxFaction::Prop);
+	}
+}
+
 void ACombatDamageableBox::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	if (UHurtboxRegistrySubsystem* HurtboxRegistry = GetWorld()->GetSubsystem<UHurtboxRegistrySubsystem>())
+	{
+		HurtboxRegistry->UnregisterHurtbox(Mesh);
+	}
+
 	// clear the death timer
 	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
 }
@@ -63,6 +81,12 @@ void ACombatDamageableBox::HandleDeath()
 	// change the collision object type to Visibility so we ignore most interactions but still retain physics collisions
 	Mesh->SetCollisionObjectType(ECC_Visibility);
 
+	// broken boxes can't be hit anymore
+	if (UHurtboxRegistrySubsystem* HurtboxRegistry = GetWorld()->GetSubsystem<UHurtboxRegistrySubsystem>())
+	{
+		HurtboxRegistry->UnregisterHurtbox(Mesh);
+	}
+
 	// call the BP handler to play effects, etc.
 	OnBoxDestroyed();
 
@@ -4,6 +4,9 @@
 #include "Components/SceneComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "PhysicsEngine/PhysicsConstraintComponent.h"
+#include "Subsystems/AimableRegistrySubsystem.h"
+#include "Gameplay/CombatCollision.h"
+#include "Subsystems/HurtboxRegistrySubsystem.h"
 
 ACombatDummy::ACombatDummy()
 {
@@ -21,6 +24,7 @@ ACombatDummy::ACombatDummy()
 	Dummy = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Dummy"));
 	Dummy->SetupAttachment(RootComponent);
 
+	Dummy->SetCollisionProfileName(CombatCollision::DamageablePropProfile);
 	Dummy->SetSimulatePhysics(true);
 
 	// create the physics constraint
@@ -30,6 +34,39 @@ ACombatDummy::ACombatDummy()
 	PhysicsConstraint->SetConstrainedComponents(BasePlate, NAME_None, Dummy, NAME_None);
 }
 
+void ACombatDummy::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// make the dummy visible to aim assist
+	if (UAimableRegistrySubsystem* AimableRegistry = GetWorld()->GetSubsystem<UAimableRegistrySubsystem>())
+	{
+		AimableRegistry->RegisterAimable(this);
+	}
+
+	// make the dummy visible to player attacks
+	if (UHurtboxRegistrySubsystem* HurtboxRegistry = GetWorld()->GetSubsystem<UHurtboxRegistrySubsystem>())
+	{
+		HurtboxRegistry->RegisterHurtbox(Dummy, EHurtboxFaction::Prop);
+	}
+}
+
+void ACombatDummy::EndPlay(EEndPlayReason::Type EndPlayReason)
+{
+	// remove the dummy from aim assist
+	if (UAimableRegistrySubsystem* AimableRegistry = GetWorld()->GetSubsystem<UAimableRegistrySubsystem>())
+	{
+		AimableRegistry->UnregisterAimable(this);
+	}
+
+	if (UHurtboxRegistrySubsystem* HurtboxRegistry = GetWorld()->GetSubsystem<UHurtboxRegistrySubsystem>())
+	{
+		HurtboxRegistry->UnregisterHurtbox(Dummy);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ACombatDummy::ApplyDamage(float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse)
 {
 	// apply impulse to the dummy
@@ -3,6 +3,7 @@
 
 #include "Gameplay/CombatLavaFloor.h"
 #include "Interfaces/CombatDamageable.h"
+#include "Subsystems/CombatDamageSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 
 ACombatLavaFloor::ACombatLavaFloor()
@@ -19,9 +20,9 @@ ACombatLavaFloor::ACombatLavaFloor()
 void ACombatLavaFloor::OnFloorHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
 {
 	// check if the hit actor is damageable by casting to the interface
-	if (ICombatDamageable* Damageable = Cast<ICombatDamageable>(OtherActor))
+	if (Cast<ICombatDamageable>(OtherActor))
 	{
-		// damage the actor
-		Damageable->ApplyDamage(Damage, this, Hit.ImpactPoint, FVector::ZeroVector);
+		// queue the damage; repeated contacts within a frame are coalesced
+		UCombatDamageSubsystem::ApplyOrQueueDamage(OtherActor, Damage, this, Hit.ImpactPoint, FVector::ZeroVector);
 	}
 }
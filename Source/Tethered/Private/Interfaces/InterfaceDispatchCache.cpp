@@ -0,0 +1,171 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Interfaces/InterfaceDispatchCache.h"
+#include "Interfaces/Aimable.h"
+#include "Interfaces/CombatDamageable.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "UObject/UObjectGlobals.h"
+
+TMap<TObjectKey<UClass>, FInterfaceDispatchCache::FClassDispatch> FInterfaceDispatchCache::Classes;
+FDelegateHandle FInterfaceDispatchCache::ReloadCompleteHandle;
+FDelegateHandle FInterfaceDispatchCache::ObjectsReinstancedHandle;
+FDelegateHandle FInterfaceDispatchCache::WorldCleanupHandle;
+
+namespace
+{
+	/** Returns the byte offset of a native interface inside the object, or INDEX_NONE */
+	int32 GetNativeInterfaceOffset(const UObject* Object, UClass* InterfaceClass)
+	{
+		const void* InterfaceAddress = const_cast<UObject*>(Object)->GetInterfaceAddress(InterfaceClass);
+		return InterfaceAddress ? static_cast<int32>(static_cast<const uint8*>(InterfaceAddress) - reinterpret_cast<const uint8*>(Object)) : INDEX_NONE;
+	}
+
+	/** Returns the function only if a Blueprint provides its own implementation of it */
+	UFunction* FindScriptOverride(UClass* Class, FName FunctionName, UClass* InterfaceClass)
+	{
+		// functions that resolve to the interface itself are handled by the native implementation
+		UFunction* Function = Class->FindFunctionByName(FunctionName);
+		return (Function && Function->GetOuter() != InterfaceClass) ? Function : nullptr;
+	}
+}
+
+bool FInterfaceDispatchCache::IsAimable(const AActor* Actor)
+{
+	return Actor && Resolve(Actor).bIsAimable;
+}
+
+USceneComponent* FInterfaceDispatchCache::GetAimPointComponent(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	const FClassDispatch& Dispatch = Resolve(Actor);
+
+	// Blueprint override goes through the VM
+	if (Dispatch.GetAimPointComponentOverride)
+	{
+		USceneComponent* AimPoint = nullptr;
+		Actor->ProcessEvent(Dispatch.GetAimPointComponentOverride, &AimPoint);
+		return AimPoint;
+	}
+
+	// native implementation is a plain virtual call
+	if (IAimable* Aimable = AtOffset<IAimable>(Actor, Dispatch.AimableOffset))
+	{
+		return Aimable->GetAimPointComponent_Implementation();
+	}
+
+	return nullptr;
+}
+
+bool FInterfaceDispatchCache::CanBeTargeted(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return false;
+	}
+
+	const FClassDispatch& Dispatch = Resolve(Actor);
+
+	// Blueprint override goes through the VM
+	if (Dispatch.CanBeTargetedOverride)
+	{
+		bool bCanBeTargeted = true;
+		Actor->ProcessEvent(Dispatch.CanBeTargetedOverride, &bCanBeTargeted);
+		return bCanBeTargeted;
+	}
+
+	// native implementation is a plain virtual call
+	if (IAimable* Aimable = AtOffset<IAimable>(Actor, Dispatch.AimableOffset))
+	{
+		return Aimable->CanBeTargeted_Implementation();
+	}
+
+	return true;
+}
+
+ICombatDamageable* FInterfaceDispatchCache::GetDamageable(AActor* Actor)
+{
+	return Actor ? AtOffset<ICombatDamageable>(Actor, Resolve(Actor).DamageableOffset) : nullptr;
+}
+
+void FInterfaceDispatchCache::Reset()
+{
+	Classes.Empty();
+}
+
+void FInterfaceDispatchCache::RegisterResetDelegates()
+{
+	// hot reload and live coding replace classes and their functions
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+	{
+		Reset();
+	});
+
+#if WITH_EDITOR
+	// Blueprint recompiles reinstance the class and free the old UFunctions
+	ObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const TMap<UObject*, UObject*>&)
+	{
+		Reset();
+	});
+#endif
+
+	// classes loaded with a level can be garbage collected once it's torn down
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddLambda([](UWorld*, bool, bool)
+	{
+		Reset();
+	});
+}
+
+void FInterfaceDispatchCache::UnregisterResetDelegates()
+{
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	ReloadCompleteHandle.Reset();
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReinstanced.Remove(ObjectsReinstancedHandle);
+	ObjectsReinstancedHandle.Reset();
+#endif
+
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	WorldCleanupHandle.Reset();
+
+	Reset();
+}
+
+const FInterfaceDispatchCache::FClassDispatch& FInterfaceDispatchCache::Resolve(const UObject* Object)
+{
+	check(IsInGameThread());
+
+	UClass* Class = Object->GetClass();
+	if (const FClassDispatch* Cached = Classes.Find(Class))
+	{
+		return *Cached;
+	}
+
+	// first time we see this class: do all the reflection work once
+	FClassDispatch& Dispatch = Classes.Add(Class);
+
+	UClass* AimableClass = UAimable::StaticClass();
+	Dispatch.bIsAimable = Class->ImplementsInterface(AimableClass);
+	if (Dispatch.bIsAimable)
+	{
+		Dispatch.AimableOffset = GetNativeInterfaceOffset(Object, AimableClass);
+		Dispatch.GetAimPointComponentOverride = FindScriptOverride(Class, GET_FUNCTION_NAME_CHECKED(IAimable, GetAimPointComponent), AimableClass);
+		Dispatch.CanBeTargetedOverride = FindScriptOverride(Class, GET_FUNCTION_NAME_CHECKED(IAimable, CanBeTargeted), AimableClass);
+
+		// Blueprint-only implementers have no native interface, so always go through the VM
+		if (Dispatch.AimableOffset == INDEX_NONE)
+		{
+			Dispatch.GetAimPointComponentOverride = Class->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(IAimable, GetAimPointComponent));
+			Dispatch.CanBeTargetedOverride = Class->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(IAimable, CanBeTargeted));
+		}
+	}
+
+	Dispatch.DamageableOffset = GetNativeInterfaceOffset(Object, UCombatDamageable::StaticClass());
+
+	return Dispatch;
+}
@@ -0,0 +1,208 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/AILODSubsystem.h"
+#include "Subsystems/PlayerInfoSubsystem.h"
+#include "SignificanceManager.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI LOD High"), STAT_AILOD_High, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI LOD Medium"), STAT_AILOD_Medium, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI LOD Low"), STAT_AILOD_Low, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI LOD Dormant"), STAT_AILOD_Dormant, STATGROUP_Game);
+
+/** Significance Manager tag for AI pawns */
+static const FName AILODTag(TEXT("AILOD"));
+
+FAILODBucket UAILODSubsystem::Buckets[static_cast<int32>(EAILOD::Num)] =
+{
+	{ 1500.0f, 0.0f, 0.0f },		// High
+	{ 4000.0f, 0.1f, 0.1f },		// Medium
+	{ 8000.0f, 0.25f, 0.25f },		// Low
+	{ UE_BIG_NUMBER, 0.5f, 0.5f }	// Dormant
+};
+
+float UAILODSubsystem::PromotionHoldTime = 3.0f;
+
+void UAILODSubsystem::RegisterAI(APawn* Pawn)
+{
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (!IsValid(Pawn) || !SignificanceManager || States.Contains(Pawn))
+	{
+		return;
+	}
+
+	States.Add(Pawn);
+
+	// the manager keeps the highest significance across viewpoints, so the most detailed bucket any player sees wins.
+	// Significance is the bucket inverted, higher meaning more detail
+	auto SignificanceFunction = [this](USignificanceManager::FManagedObjectInfo* Info, const FTransform& Viewpoint) -> float
+	{
+		const APawn* ManagedPawn = Cast<APawn>(Info->GetObject());
+		const FAILODState* State = States.Find(ManagedPawn);
+		if (!ManagedPawn || !State)
+		{
+			return 0.0f;
+		}
+
+		return static_cast<float>(static_cast<int32>(EAILOD::Num) - static_cast<int32>(EvaluateLOD(*ManagedPawn, *State, Viewpoint)));
+	};
+
+	// only touch the tick functions when the bucket actually changed
+	auto PostSignificanceFunction = [this](USignificanceManager::FManagedObjectInfo* Info, float OldSignificance, float Significance, bool bFinal)
+	{
+		APawn* ManagedPawn = Cast<APawn>(Info->GetObject());
+		FAILODState* State = States.Find(ManagedPawn);
+		if (!ManagedPawn || !State)
+		{
+			return;
+		}
+
+		const int32 BucketIndex = FMath::Clamp(static_cast<int32>(EAILOD::Num) - FMath::RoundToInt32(Significance), 0, static_cast<int32>(EAILOD::Num) - 1);
+		const EAILOD NewLOD = static_cast<EAILOD>(BucketIndex);
+		if (NewLOD != State->LOD)
+		{
+			State->LOD = NewLOD;
+			ApplyLOD(*ManagedPawn, NewLOD);
+		}
+	};
+
+	SignificanceManager->RegisterObject(Pawn, AILODTag, SignificanceFunction, USignificanceManager::EPostSignificanceType::Sequential, PostSignificanceFunction);
+}
+
+void UAILODSubsystem::UnregisterAI(APawn* Pawn)
+{
+	if (States.Remove(Pawn) == 0)
+	{
+		return;
+	}
+
+	if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterObject(Pawn);
+	}
+
+	// leave the pawn at full rate for whoever picks it up next, e.g. the enemy pool
+	if (IsValid(Pawn))
+	{
+		ApplyLOD(*Pawn, EAILOD::High);
+	}
+}
+
+void UAILODSubsystem::PromoteAI(APawn* Pawn)
+{
+	FAILODState* State = States.Find(Pawn);
+	if (!State)
+	{
+		return;
+	}
+
+	// hold the promotion so the next evaluations don't drop the pawn back right away
+	State->PromotedUntil = GetWorld()->GetTimeSeconds() + PromotionHoldTime;
+
+	if (State->LOD != EAILOD::High)
+	{
+		State->LOD = EAILOD::High;
+		ApplyLOD(*Pawn, EAILOD::High);
+	}
+}
+
+void UAILODSubsystem::Deinitialize()
+{
+	States.Empty();
+
+	Super::Deinitialize();
+}
+
+void UAILODSubsystem::Tick(float DeltaTime)
+{
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	UPlayerInfoSubsystem* PlayerInfo = GetWorld()->GetSubsystem<UPlayerInfoSubsystem>();
+	if (!SignificanceManager || !PlayerInfo || States.IsEmpty())
+	{
+		return;
+	}
+
+	// every player's pawn is a viewpoint, so distance is measured to the nearest player
+	Viewpoints.Reset();
+	for (const FPlayerInfo& Player : PlayerInfo->GetPlayers())
+	{
+		Viewpoints.Emplace(Player.Location);
+	}
+
+	// with no player around, keep the current buckets rather than dropping everyone to the lowest one
+	if (Viewpoints.IsEmpty())
+	{
+		return;
+	}
+
+	SignificanceManager->Update(Viewpoints);
+
+#if STATS
+	int32 Counts[static_cast<int32>(EAILOD::Num)] = {};
+	for (const TPair<TObjectKey<APawn>, FAILODState>& Pair : States)
+	{
+		++Counts[static_cast<int32>(Pair.Value.LOD)];
+	}
+
+	SET_DWORD_STAT(STAT_AILOD_High, Counts[static_cast<int32>(EAILOD::High)]);
+	SET_DWORD_STAT(STAT_AILOD_Medium, Counts[static_cast<int32>(EAILOD::Medium)]);
+	SET_DWORD_STAT(STAT_AILOD_Low, Counts[static_cast<int32>(EAILOD::Low)]);
+	SET_DWORD_STAT(STAT_AILOD_Dormant, Counts[static_cast<int32>(EAILOD::Dormant)]);
+#endif
+}
+
+TStatId UAILODSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAILODSubsystem, STATGROUP_Tickables);
+}
+
+bool UAILODSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+EAILOD UAILODSubsystem::EvaluateLOD(const APawn& Pawn, const FAILODState& State, const FTransform& Viewpoint) const
+{
+	// recently promoted pawns stay at full rate
+	if (State.PromotedUntil > GetWorld()->GetTimeSeconds())
+	{
+		return EAILOD::High;
+	}
+
+	// the first bucket whose range contains the pawn
+	const double DistSq = FVector::DistSquared(Pawn.GetActorLocation(), Viewpoint.GetLocation());
+	int32 BucketIndex = 0;
+	while (BucketIndex < static_cast<int32>(EAILOD::Dormant) && DistSq > FMath::Square(Buckets[BucketIndex].MaxDistance))
+	{
+		++BucketIndex;
+	}
+
+	// anything on screen is at least medium, so visible AI never looks sluggish
+	if (BucketIndex > static_cast<int32>(EAILOD::Medium) && Pawn.WasRecentlyRendered(0.2f))
+	{
+		BucketIndex = static_cast<int32>(EAILOD::Medium);
+	}
+
+	return static_cast<EAILOD>(BucketIndex);
+}
+
+void UAILODSubsystem::ApplyLOD(APawn& Pawn, EAILOD LOD)
+{
+	AAIController* AIController = Cast<AAIController>(Pawn.GetController());
+	if (!AIController)
+	{
+		return;
+	}
+
+	// update the cooldowns as well, so a promoted pawn doesn't wait out the rest of its old interval
+	const FAILODBucket& Bucket = Buckets[static_cast<int32>(LOD)];
+	AIController->PrimaryActorTick.UpdateTickIntervalAndCoolDown(Bucket.ControllerTickInterval);
+
+	if (UBrainComponent* Brain = AIController->GetBrainComponent())
+	{
+		Brain->SetComponentTickIntervalAndCooldown(Bucket.StateTreeTickInterval);
+	}
+}
@@ -0,0 +1,309 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/AimAssistSolverSubsystem.h"
+#include "Components/AimAssistComponent.h"
+#include "Components/AimAssistStats.h"
+#include "Data/AimAssistProfile.h"
+#include "Gameplay/AimAssistVisibilityVolume.h"
+#include "Interfaces/InterfaceDispatchCache.h"
+#include "Engine/World.h"
+
+bool UAimAssistSolverSubsystem::bVisibilityGridEnabled = true;
+
+UAimAssistSolverSubsystem::UAimAssistSolverSubsystem()
+{
+	LineOfSightTraceDelegate.BindUObject(this, &UAimAssistSolverSubsystem::OnLineOfSightTraceDone);
+}
+
+void UAimAssistSolverSubsystem::RegisterPlayer(UAimAssistComponent* Player)
+{
+	if (IsValid(Player))
+	{
+		Players.AddUnique(Player);
+	}
+}
+
+void UAimAssistSolverSubsystem::UnregisterPlayer(UAimAssistComponent* Player)
+{
+	Players.Remove(Player);
+	QueryRequests.Remove(Player);
+}
+
+void UAimAssistSolverSubsystem::RegisterVisibilityVolume(AAimAssistVisibilityVolume* Volume)
+{
+	if (IsValid(Volume))
+	{
+		VisibilityVolumes.AddUnique(Volume);
+	}
+}
+
+void UAimAssistSolverSubsystem::UnregisterVisibilityVolume(AAimAssistVisibilityVolume* Volume)
+{
+	VisibilityVolumes.Remove(Volume);
+}
+
+void UAimAssistSolverSubsystem::RequestQuery(UAimAssistComponent* Player)
+{
+	if (IsValid(Player))
+	{
+		QueryRequests.AddUnique(Player);
+	}
+}
+
+EAimAssistLineOfSight UAimAssistSolverSubsystem::RequestLineOfSight(const FVector& From, AActor* Target, const FVector& To, ECollisionChannel Channel,
+	UAimAssistComponent* Requester, int32 RequestIndex, uint32 QuerySerial)
+{
+	// static arenas answer most LOS checks from their baked grid without touching physics
+	if (bVisibilityGridEnabled)
+	{
+		for (const TWeakObjectPtr<AAimAssistVisibilityVolume>& Volume : VisibilityVolumes)
+		{
+			AAimAssistVisibilityVolume* VisibilityVolume = Volume.Get();
+			if (!VisibilityVolume)
+			{
+				continue;
+			}
+
+			const EAimAssistBakedVisibility Baked = VisibilityVolume->QueryVisibility(From, To, Channel);
+			if (Baked != EAimAssistBakedVisibility::Unknown)
+			{
+				INC_DWORD_STAT(STAT_AimAssist_LOSGrid);
+				return Baked == EAimAssistBakedVisibility::Visible ? EAimAssistLineOfSight::Visible : EAimAssistLineOfSight::Blocked;
+			}
+		}
+	}
+
+	FLineOfSightKey Key;
+	Key.FromCell = FIntVector(FMath::FloorToInt32(From.X / LineOfSightCellSize), FMath::FloorToInt32(From.Y / LineOfSightCellSize), FMath::FloorToInt32(From.Z / LineOfSightCellSize));
+	Key.ToCell = FIntVector(FMath::FloorToInt32(To.X / LineOfSightCellSize), FMath::FloorToInt32(To.Y / LineOfSightCellSize), FMath::FloorToInt32(To.Z / LineOfSightCellSize));
+	Key.Target = Target;
+	Key.Channel = static_cast<uint8>(Channel);
+
+	if (FLineOfSightEntry* Entry = LineOfSightCache.Find(Key))
+	{
+		INC_DWORD_STAT(STAT_AimAssist_LOSShared);
+
+		// a recent result for the same endpoints is reused as is
+		if (Entry->bDone)
+		{
+			return Entry->bHasLOS ? EAimAssistLineOfSight::Visible : EAimAssistLineOfSight::Blocked;
+		}
+
+		// the same trace is already in flight, wait for it
+		Entry->Waiters.Add({ Requester, RequestIndex, QuerySerial });
+		return EAimAssistLineOfSight::Pending;
+	}
+
+	// no match, issue a new shared trace. Players never block each other's line of sight
+	FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(AimAssist_LOS), false);
+	for (const TWeakObjectPtr<UAimAssistComponent>& Player : Players)
+	{
+		if (Player.IsValid())
+		{
+			TraceParams.AddIgnoredActor(Player->GetOwner());
+		}
+	}
+
+	const uint32 TraceId = NextTraceId++;
+
+	FLineOfSightEntry& NewEntry = LineOfSightCache.Add(Key);
+	NewEntry.Target = Target;
+	NewEntry.TraceId = TraceId;
+	NewEntry.Time = GetWorld()->GetTimeSeconds();
+	NewEntry.Waiters.Add({ Requester, RequestIndex, QuerySerial });
+	InFlightTraces.Add(TraceId, Key);
+
+	GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, From, To, Channel, TraceParams,
+		FCollisionResponseParams::DefaultResponseParam, &LineOfSightTraceDelegate, TraceId);
+
+	INC_DWORD_STAT(STAT_AimAssist_LOSTraces);
+	return EAimAssistLineOfSight::Pending;
+}
+
+void UAimAssistSolverSubsystem::Deinitialize()
+{
+	Players.Empty();
+	VisibilityVolumes.Empty();
+	QueryRequests.Empty();
+	Candidates.Empty();
+	Snapshot.Reset();
+	LineOfSightCache.Empty();
+	InFlightTraces.Empty();
+
+	Super::Deinitialize();
+}
+
+void UAimAssistSolverSubsystem::Tick(float DeltaTime)
+{
+	// drop LOS results too old to share, and traces whose result never came back
+	const double Now = GetWorld()->GetTimeSeconds();
+	TArray<FLineOfSightWaiter, TInlineAllocator<4>> ExpiredWaiters;
+	for (auto It = LineOfSightCache.CreateIterator(); It; ++It)
+	{
+		FLineOfSightEntry& Entry = It.Value();
+		if (Entry.bDone ? Now - Entry.Time > LineOfSightCacheLifetime : Now - Entry.Time > LineOfSightInFlightTimeout)
+		{
+			if (!Entry.bDone)
+			{
+				InFlightTraces.Remove(Entry.TraceId);
+				ExpiredWaiters.Append(Entry.Waiters);
+			}
+
+			It.RemoveCurrent();
+		}
+	}
+
+	// answer anyone still waiting on a lost trace so their query can resolve
+	for (const FLineOfSightWaiter& Waiter : ExpiredWaiters)
+	{
+		if (UAimAssistComponent* Requester = Waiter.Requester.Get())
+		{
+			Requester->OnSharedLineOfSight(Waiter.RequestIndex, Waiter.QuerySerial, false);
+		}
+	}
+
+#if STATS
+	// every player keeps its own rate; publish the busiest one so players don't overwrite each other
+	float MaxQueryRate = 0.f;
+	for (const TWeakObjectPtr<UAimAssistComponent>& Player : Players)
+	{
+		if (const UAimAssistComponent* AimAssist = Player.Get())
+		{
+			MaxQueryRate = FMath::Max(MaxQueryRate, AimAssist->EffectiveQueryRate);
+		}
+	}
+	SET_FLOAT_STAT(STAT_AimAssist_QueryRate, MaxQueryRate);
+#endif
+
+	// tickables run after every actor has ticked, so all of this frame's requests are in
+	QueryRequests.RemoveAllSwap([](const TWeakObjectPtr<UAimAssistComponent>& Player) { return !Player.IsValid(); });
+	if (QueryRequests.IsEmpty())
+	{
+		return;
+	}
+
+	UAimableRegistrySubsystem* AimableRegistry = GetWorld()->GetSubsystem<UAimableRegistrySubsystem>();
+	if (!AimableRegistry)
+	{
+		QueryRequests.Reset();
+		return;
+	}
+
+	BuildSnapshot(*AimableRegistry);
+
+	// launch a selection task for every requesting player against the shared snapshot
+	TArray<TWeakObjectPtr<UAimAssistComponent>> Requests = MoveTemp(QueryRequests);
+	QueryRequests.Reset();
+
+	for (const TWeakObjectPtr<UAimAssistComponent>& Player : Requests)
+	{
+		if (UAimAssistComponent* AimAssist = Player.Get())
+		{
+			AimAssist->QueryForTarget(*this);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_AimAssist_PlayersQueried, Requests.Num());
+}
+
+TStatId UAimAssistSolverSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAimAssistSolverSubsystem, STATGROUP_Tickables);
+}
+
+bool UAimAssistSolverSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAimAssistSolverSubsystem::BuildSnapshot(UAimableRegistrySubsystem& AimableRegistry)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AimAssist_SolverGather);
+
+	// one circle that covers every requesting player's assist range
+	FBox2D Bounds(ForceInit);
+	FVector SingleOrigin = FVector::ZeroVector;
+	float SingleRange = 0.f;
+	int32 NumBounded = 0;
+	for (const TWeakObjectPtr<UAimAssistComponent>& Player : QueryRequests)
+	{
+		FVector Origin;
+		float Range = 0.f;
+		if (Player->GetQueryBounds(Origin, Range))
+		{
+			Bounds += FVector2D(Origin.X - Range, Origin.Y - Range);
+			Bounds += FVector2D(Origin.X + Range, Origin.Y + Range);
+			SingleOrigin = Origin;
+			SingleRange = Range;
+			NumBounded++;
+		}
+	}
+
+	Candidates.Reset();
+	if (NumBounded == 1)
+	{
+		// a single player gets the exact assist circle
+		AimableRegistry.QueryInRadius2D(SingleOrigin, SingleRange, Candidates);
+	}
+	else if (NumBounded > 1)
+	{
+		const FVector2D Center = Bounds.GetCenter();
+		AimableRegistry.QueryInRadius2D(FVector(Center.X, Center.Y, 0.0), Bounds.GetExtent().Size(), Candidates);
+	}
+
+	// a fresh snapshot every frame, since tasks launched on earlier frames may still be reading theirs
+	TSharedRef<FAimAssistSnapshot, ESPMode::ThreadSafe> NewSnapshot = MakeShared<FAimAssistSnapshot, ESPMode::ThreadSafe>();
+	NewSnapshot->Time = GetWorld()->GetTimeSeconds();
+	NewSnapshot->Actors.Reserve(Candidates.Num());
+	NewSnapshot->ActorKeys.Reserve(Candidates.Num());
+	NewSnapshot->AimPoints.Reserve(Candidates.Num());
+	NewSnapshot->Targetable.Reserve(Candidates.Num());
+	NewSnapshot->Inputs.Reset(Candidates.Num());
+
+	for (const FAimableCandidate& Candidate : Candidates)
+	{
+		NewSnapshot->Actors.Add(Candidate.Actor);
+		NewSnapshot->ActorKeys.Add(Candidate.Actor);
+		NewSnapshot->AimPoints.Add(Candidate.AimPoint);
+		NewSnapshot->Inputs.Add(Candidate.AimPoint, Candidate.Velocity, false);
+
+		// interface calls can run Blueprint, so targetability is resolved here and only read by the tasks
+		NewSnapshot->Targetable.Add(FInterfaceDispatchCache::CanBeTargeted(Candidate.Actor));
+	}
+
+	Snapshot = NewSnapshot;
+
+	INC_DWORD_STAT_BY(STAT_AimAssist_Candidates, Candidates.Num());
+}
+
+void UAimAssistSolverSubsystem::OnLineOfSightTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	FLineOfSightKey Key;
+	if (!InFlightTraces.RemoveAndCopyValue(static_cast<uint32>(TraceDatum.UserData), Key))
+	{
+		return;
+	}
+
+	FLineOfSightEntry* Entry = LineOfSightCache.Find(Key);
+	if (!Entry)
+	{
+		return;
+	}
+
+	const FHitResult* BlockingHit = FHitResult::GetFirstBlockingHit(TraceDatum.OutHits);
+	Entry->bHasLOS = !BlockingHit || BlockingHit->GetActor() == Entry->Target.Get();
+	Entry->bDone = true;
+	Entry->Time = GetWorld()->GetTimeSeconds();
+
+	// notify waiters from a copy, since a callback may resolve a query and request new traces
+	const TArray<FLineOfSightWaiter, TInlineAllocator<4>> Waiters = MoveTemp(Entry->Waiters);
+	const bool bHasLOS = Entry->bHasLOS;
+
+	for (const FLineOfSightWaiter& Waiter : Waiters)
+	{
+		if (UAimAssistComponent* Requester = Waiter.Requester.Get())
+		{
+			Requester->OnSharedLineOfSight(Waiter.RequestIndex, Waiter.QuerySerial, bHasLOS);
+		}
+	}
+}
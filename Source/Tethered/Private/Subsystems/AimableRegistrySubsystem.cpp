@@ -0,0 +1,207 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/AimableRegistrySubsystem.h"
+#include "Interfaces/InterfaceDispatchCache.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+void UAimableRegistrySubsystem::RegisterAimable(AActor* Aimable)
+{
+	// only IAimable actors belong in the registry
+	if (!IsValid(Aimable) || !FInterfaceDispatchCache::IsAimable(Aimable))
+	{
+		return;
+	}
+
+	// ignore duplicate registrations
+	if (EntryIndices.Contains(Aimable))
+	{
+		return;
+	}
+
+	FEntry& NewEntry = Entries.AddDefaulted_GetRef();
+	NewEntry.Actor = Aimable;
+	NewEntry.ActorKey = Aimable;
+
+	// resolve the aim point component once; it's re-sampled for position every frame
+	NewEntry.AimPointComponent = FInterfaceDispatchCache::GetAimPointComponent(Aimable);
+	SampleEntry(NewEntry);
+	NewEntry.Cell = GetCell(NewEntry.AimPoint);
+
+	const int32 NewIndex = Entries.Num() - 1;
+	EntryIndices.Add(Aimable, NewIndex);
+	Cells.FindOrAdd(NewEntry.Cell).Add(NewIndex);
+}
+
+void UAimableRegistrySubsystem::UnregisterAimable(AActor* Aimable)
+{
+	if (const int32* Index = EntryIndices.Find(Aimable))
+	{
+		RemoveEntryAt(*Index);
+	}
+}
+
+void UAimableRegistrySubsystem::QueryInRadius2D(const FVector& Center, float Radius, TArray<FAimableCandidate>& OutCandidates, const AActor* IgnoreActor) const
+{
+	OutCandidates.Reset();
+
+	const float RadiusSq = Radius * Radius;
+	const FIntPoint MinCell = GetCell(Center - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = GetCell(Center + FVector(Radius, Radius, 0.0f));
+
+	// visit only the cells overlapped by the query circle's bounding square
+	for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			const TArray<int32, TInlineAllocator<8>>* CellEntries = Cells.Find(FIntPoint(X, Y));
+			if (!CellEntries)
+			{
+				continue;
+			}
+
+			for (const int32 Index : *CellEntries)
+			{
+				const FEntry& Entry = Entries[Index];
+				AActor* Actor = Entry.Actor.Get();
+				if (!Actor || Actor == IgnoreActor)
+				{
+					continue;
+				}
+
+				if (FVector::DistSquared2D(Center, Entry.AimPoint) <= RadiusSq)
+				{
+					OutCandidates.Add({ Actor, Entry.AimPoint, Entry.Velocity });
+				}
+			}
+		}
+	}
+}
+
+bool UAimableRegistrySubsystem::GetCachedAimPoint(const AActor* Aimable, FVector& OutAimPoint) const
+{
+	if (const int32* Index = EntryIndices.Find(Aimable))
+	{
+		OutAimPoint = Entries[*Index].AimPoint;
+		return true;
+	}
+	return false;
+}
+
+void UAimableRegistrySubsystem::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndices.Empty();
+	Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+void UAimableRegistrySubsystem::Tick(float DeltaTime)
+{
+	// walk backwards so stale entries can be swap-removed in place
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		FEntry& Entry = Entries[Index];
+
+		// drop actors that were destroyed without unregistering
+		if (!Entry.Actor.IsValid())
+		{
+			RemoveEntryAt(Index);
+			continue;
+		}
+
+		// refresh the aim point and re-bin it if it crossed a cell boundary
+		SampleEntry(Entry);
+
+		const FIntPoint NewCell = GetCell(Entry.AimPoint);
+		if (NewCell != Entry.Cell)
+		{
+			MoveEntryCell(Index, NewCell);
+		}
+	}
+}
+
+TStatId UAimableRegistrySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAimableRegistrySubsystem, STATGROUP_Tickables);
+}
+
+bool UAimableRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FIntPoint UAimableRegistrySubsystem::GetCell(const FVector& Location)
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UAimableRegistrySubsystem::SampleEntry(FEntry& Entry)
+{
+	const AActor* Actor = Entry.Actor.Get();
+	if (!Actor)
+	{
+		return;
+	}
+
+	const USceneComponent* AimPointComponent = Entry.AimPointComponent.Get();
+	Entry.AimPoint = AimPointComponent ? AimPointComponent->GetComponentLocation() : Actor->GetActorLocation();
+
+	const USceneComponent* RootComponent = Actor->GetRootComponent();
+	Entry.Velocity = RootComponent ? RootComponent->GetComponentVelocity() : FVector::ZeroVector;
+}
+
+void UAimableRegistrySubsystem::RemoveEntryAt(int32 Index)
+{
+	// remove the entry from its cell
+	if (TArray<int32, TInlineAllocator<8>>* CellEntries = Cells.Find(Entries[Index].Cell))
+	{
+		CellEntries->RemoveSingleSwap(Index);
+		if (CellEntries->IsEmpty())
+		{
+			Cells.Remove(Entries[Index].Cell);
+		}
+	}
+
+	// the cached key stays valid for lookup even after the actor is gone
+	EntryIndices.Remove(Entries[Index].ActorKey);
+
+	// swap the last entry into the freed slot and patch its references
+	const int32 LastIndex = Entries.Num() - 1;
+	if (Index != LastIndex)
+	{
+		const FEntry& LastEntry = Entries[LastIndex];
+
+		if (TArray<int32, TInlineAllocator<8>>* LastCellEntries = Cells.Find(LastEntry.Cell))
+		{
+			const int32 Slot = LastCellEntries->Find(LastIndex);
+			if (Slot != INDEX_NONE)
+			{
+				(*LastCellEntries)[Slot] = Index;
+			}
+		}
+
+		EntryIndices.Add(LastEntry.ActorKey, Index);
+	}
+
+	Entries.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UAimableRegistrySubsystem::MoveEntryCell(int32 Index, const FIntPoint& NewCell)
+{
+	FEntry& Entry = Entries[Index];
+
+	if (TArray<int32, TInlineAllocator<8>>* OldCellEntries = Cells.Find(Entry.Cell))
+	{
+		OldCellEntries->RemoveSingleSwap(Index);
+		if (OldCellEntries->IsEmpty())
+		{
+			Cells.Remove(Entry.Cell);
+		}
+	}
+
+	Entry.Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Add(Index);
+}
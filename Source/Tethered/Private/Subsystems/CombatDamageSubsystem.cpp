@@ -0,0 +1,127 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/CombatDamageSubsystem.h"
+#include "Interfaces/CombatDamageable.h"
+#include "Interfaces/InterfaceDispatchCache.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+
+void FCombatDamageTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target)
+	{
+		Target->Drain();
+	}
+}
+
+FString FCombatDamageTickFunction::DiagnosticMessage()
+{
+	return TEXT("UCombatDamageSubsystem::Drain");
+}
+
+FName FCombatDamageTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("CombatDamage"));
+}
+
+void UCombatDamageSubsystem::QueueDamage(AActor* Target, float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse)
+{
+	if (!Target)
+	{
+		return;
+	}
+
+	// one entry per target per frame
+	int32& Index = PendingIndices.FindOrAdd(Target, INDEX_NONE);
+	if (Index == INDEX_NONE)
+	{
+		Index = Pending.AddDefaulted();
+		Pending[Index].Target = Target;
+	}
+
+	FPendingDamage& Entry = Pending[Index];
+	Entry.Damage += Damage;
+	Entry.DamageImpulse += DamageImpulse;
+
+	// the strongest hit decides where the combined hit lands and who dealt it
+	if (Damage > Entry.StrongestHit)
+	{
+		Entry.StrongestHit = Damage;
+		Entry.DamageCauser = DamageCauser;
+		Entry.DamageLocation = DamageLocation;
+	}
+}
+
+void UCombatDamageSubsystem::ApplyOrQueueDamage(AActor* Target, float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse)
+{
+	if (!Target)
+	{
+		return;
+	}
+
+	UWorld* World = Target->GetWorld();
+	if (UCombatDamageSubsystem* DamageSubsystem = World ? World->GetSubsystem<UCombatDamageSubsystem>() : nullptr)
+	{
+		DamageSubsystem->QueueDamage(Target, Damage, DamageCauser, DamageLocation, DamageImpulse);
+	}
+	else if (ICombatDamageable* Damageable = FInterfaceDispatchCache::GetDamageable(Target))
+	{
+		Damageable->ApplyDamage(Damage, DamageCauser, DamageLocation, DamageImpulse);
+	}
+}
+
+void UCombatDamageSubsystem::Drain()
+{
+	if (Pending.IsEmpty())
+	{
+		return;
+	}
+
+	// damage reactions can deal damage of their own; swap first so those hits land next frame
+	Swap(Pending, Draining);
+	PendingIndices.Reset();
+
+	for (const FPendingDamage& Entry : Draining)
+	{
+		// the target may have been destroyed since it was hit
+		AActor* Target = Entry.Target.Get();
+		if (ICombatDamageable* Damageable = FInterfaceDispatchCache::GetDamageable(Target))
+		{
+			Damageable->ApplyDamage(Entry.Damage, Entry.DamageCauser.Get(), Entry.DamageLocation, Entry.DamageImpulse);
+		}
+	}
+
+	Draining.Reset();
+}
+
+void UCombatDamageSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// drain after physics so both animation driven sweeps and physics hit events from this frame are in
+	DrainTick.Target = this;
+	DrainTick.bCanEverTick = true;
+	DrainTick.bStartWithTickEnabled = true;
+	DrainTick.TickGroup = TG_PostPhysics;
+	DrainTick.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UCombatDamageSubsystem::Deinitialize()
+{
+	if (DrainTick.IsTickFunctionRegistered())
+	{
+		DrainTick.UnRegisterTickFunction();
+	}
+	DrainTick.Target = nullptr;
+
+	Pending.Empty();
+	PendingIndices.Empty();
+	Draining.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UCombatDamageSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,154 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/CombatSpawnSchedulerSubsystem.h"
+#include "AI/CombatEnemySpawner.h"
+#include "Subsystems/PlayerInfoSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+
+DECLARE_CYCLE_STAT(TEXT("Scheduled Spawns"), STAT_SpawnScheduler_Spawn, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Spawns"), STAT_SpawnScheduler_Pending, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Pool Warm-ups"), STAT_SpawnScheduler_PendingWarmups, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spawns This Frame"), STAT_SpawnScheduler_Served, STATGROUP_Game);
+
+int32 UCombatSpawnSchedulerSubsystem::MaxSpawnsPerFrame = 1;
+float UCombatSpawnSchedulerSubsystem::SpawnBudgetMs = 2.0f;
+
+void UCombatSpawnSchedulerSubsystem::RequestSpawn(ACombatEnemySpawner* Spawner)
+{
+	if (IsValid(Spawner))
+	{
+		Pending.AddUnique(Spawner);
+	}
+}
+
+void UCombatSpawnSchedulerSubsystem::RequestPoolWarmup(ACombatEnemySpawner* Spawner)
+{
+	if (IsValid(Spawner))
+	{
+		PendingWarmups.AddUnique(Spawner);
+	}
+}
+
+void UCombatSpawnSchedulerSubsystem::CancelSpawn(ACombatEnemySpawner* Spawner)
+{
+	Pending.Remove(Spawner);
+	PendingWarmups.Remove(Spawner);
+}
+
+void UCombatSpawnSchedulerSubsystem::Deinitialize()
+{
+	Pending.Empty();
+	PendingWarmups.Empty();
+
+	Super::Deinitialize();
+}
+
+void UCombatSpawnSchedulerSubsystem::Tick(float DeltaTime)
+{
+	SET_DWORD_STAT(STAT_SpawnScheduler_Pending, Pending.Num());
+	SET_DWORD_STAT(STAT_SpawnScheduler_PendingWarmups, PendingWarmups.Num());
+
+	if (Pending.IsEmpty() && PendingWarmups.IsEmpty())
+	{
+		SET_DWORD_STAT(STAT_SpawnScheduler_Served, 0);
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SpawnScheduler_Spawn);
+
+	SortByPriority();
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = SpawnBudgetMs * 0.001;
+	const int32 MaxSpawns = FMath::Max(MaxSpawnsPerFrame, 1);
+
+	// the first request always goes through; the time budget only stops the ones after it
+	int32 NumServed = 0;
+	auto HasBudget = [&NumServed, MaxSpawns, StartTime, BudgetSeconds]()
+	{
+		return NumServed < MaxSpawns && (NumServed == 0 || FPlatformTime::Seconds() - StartTime < BudgetSeconds);
+	};
+
+	while (!Pending.IsEmpty() && HasBudget())
+	{
+		// dequeue before spawning, so the spawner can queue its next request from inside the spawn
+		ACombatEnemySpawner* Spawner = Pending[0].Get();
+		Pending.RemoveAt(0, EAllowShrinking::No);
+
+		// spawners removed from the level since their request are skipped without using the budget
+		if (!Spawner)
+		{
+			continue;
+		}
+
+		Spawner->SpawnEnemy();
+		++NumServed;
+	}
+
+	// warm-ups only get what the spawns left over
+	while (!PendingWarmups.IsEmpty() && HasBudget())
+	{
+		ACombatEnemySpawner* Spawner = PendingWarmups[0].Get();
+		PendingWarmups.RemoveAt(0, EAllowShrinking::No);
+
+		if (!Spawner)
+		{
+			continue;
+		}
+
+		// one pooled enemy per request; spawners that want more go to the back of the line
+		if (Spawner->WarmPoolStep())
+		{
+			PendingWarmups.Add(Spawner);
+		}
+
+		++NumServed;
+	}
+
+	SET_DWORD_STAT(STAT_SpawnScheduler_Served, NumServed);
+}
+
+TStatId UCombatSpawnSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatSpawnSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+bool UCombatSpawnSchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatSpawnSchedulerSubsystem::SortByPriority()
+{
+	// without a player, serve requests in the order they came in
+	UPlayerInfoSubsystem* PlayerInfo = GetWorld()->GetSubsystem<UPlayerInfoSubsystem>();
+	if (!PlayerInfo || PlayerInfo->GetPlayers().IsEmpty())
+	{
+		return;
+	}
+
+	// measure each spawner against whichever player is closest, so every co-op player's spawns are equally urgent.
+	// stale entries sort last and are dropped when reached
+	TArray<TPair<float, TWeakObjectPtr<ACombatEnemySpawner>>, TInlineAllocator<16>> Keyed;
+	Keyed.Reserve(Pending.Num());
+	for (const TWeakObjectPtr<ACombatEnemySpawner>& Entry : Pending)
+	{
+		float Distance = UE_BIG_NUMBER;
+		if (const ACombatEnemySpawner* Spawner = Entry.Get())
+		{
+			PlayerInfo->FindNearestPlayer(Spawner->GetActorLocation(), &Distance);
+		}
+		Keyed.Emplace(Distance, Entry);
+	}
+
+	Keyed.StableSort([](const TPair<float, TWeakObjectPtr<ACombatEnemySpawner>>& A, const TPair<float, TWeakObjectPtr<ACombatEnemySpawner>>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	for (int32 Index = 0; Index < Keyed.Num(); ++Index)
+	{
+		Pending[Index] = Keyed[Index].Value;
+	}
+}
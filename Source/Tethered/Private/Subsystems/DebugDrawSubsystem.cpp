@@ -0,0 +1,273 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/DebugDrawSubsystem.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
+
+namespace
+{
+	/** Cached shape kinds, stored in the top byte of a shape id */
+	enum class EShapeType : uint8
+	{
+		Sphere = 1,
+		Arc,
+		Cone
+	};
+
+	/** Packs a shape type, segment count and angle into a cache key */
+	UDebugDrawSubsystem::FShapeId MakeShapeId(EShapeType Type, int32 Segments, float AngleDeg)
+	{
+		// angles are quantized to a hundredth of a degree, which is plenty for visualization
+		const uint32 QuantizedAngle = static_cast<uint32>(FMath::RoundToInt32(FMath::Clamp(AngleDeg, 0.f, 360.f) * 100.f));
+		return (static_cast<uint64>(Type) << 56) | (static_cast<uint64>(FMath::Clamp(Segments, 3, 0xFFFF)) << 32) | QuantizedAngle;
+	}
+
+	/** Appends a unit circle in the plane spanned by AxisA and AxisB */
+	void AddCircle(TArray<FVector3f>& Out, const FVector3f& AxisA, const FVector3f& AxisB, int32 Segments)
+	{
+		for (int32 i = 0; i < Segments; ++i)
+		{
+			const float Angle1 = UE_TWO_PI * i / Segments;
+			const float Angle2 = UE_TWO_PI * (i + 1) / Segments;
+			Out.Add(AxisA * FMath::Cos(Angle1) + AxisB * FMath::Sin(Angle1));
+			Out.Add(AxisA * FMath::Cos(Angle2) + AxisB * FMath::Sin(Angle2));
+		}
+	}
+}
+
+UDebugDrawSubsystem::FShapeId UDebugDrawSubsystem::SphereShape(int32 Segments)
+{
+	return MakeShapeId(EShapeType::Sphere, Segments, 0.f);
+}
+
+UDebugDrawSubsystem::FShapeId UDebugDrawSubsystem::ArcShape(float AngleDeg, int32 Segments)
+{
+	return MakeShapeId(EShapeType::Arc, Segments, AngleDeg);
+}
+
+UDebugDrawSubsystem::FShapeId UDebugDrawSubsystem::ConeShape(float HalfAngleDeg, int32 Sides)
+{
+	return MakeShapeId(EShapeType::Cone, Sides, HalfAngleDeg);
+}
+
+void UDebugDrawSubsystem::AddShape(FShapeId Shape, const FTransform& Transform, const FColor& Color, float Thickness, float LifeTime)
+{
+	const TArray<FVector3f>& Segments = GetShapeSegments(Shape);
+
+	// only the transform changes from frame to frame; the geometry is reused
+	TArray<FBatchedLine>& Queue = GetLineQueue(LifeTime);
+	Queue.Reserve(Queue.Num() + Segments.Num() / 2);
+	for (int32 i = 0; i + 1 < Segments.Num(); i += 2)
+	{
+		Queue.Emplace(Transform.TransformPosition(FVector(Segments[i])), Transform.TransformPosition(FVector(Segments[i + 1])), Color, LifeTime, Thickness, SDPG_World);
+	}
+}
+
+void UDebugDrawSubsystem::AddLine(const FVector& Start, const FVector& End, const FColor& Color, float Thickness, float LifeTime)
+{
+	GetLineQueue(LifeTime).Emplace(Start, End, Color, LifeTime, Thickness, SDPG_World);
+}
+
+void UDebugDrawSubsystem::AddArrow(const FVector& Start, const FVector& End, float ArrowSize, const FColor& Color, float Thickness, float LifeTime)
+{
+	AddLine(Start, End, Color, Thickness, LifeTime);
+
+	// two head lines, in the plane containing world up when possible
+	const FVector Dir = (End - Start).GetSafeNormal();
+	FVector Side = FVector::CrossProduct(Dir, FVector::UpVector).GetSafeNormal();
+	if (Side.IsNearlyZero())
+	{
+		Side = FVector::CrossProduct(Dir, FVector::ForwardVector).GetSafeNormal();
+	}
+
+	const FVector Back = End - Dir * ArrowSize;
+	AddLine(End, Back + Side * ArrowSize * 0.5f, Color, Thickness, LifeTime);
+	AddLine(End, Back - Side * ArrowSize * 0.5f, Color, Thickness, LifeTime);
+}
+
+void UDebugDrawSubsystem::AddText(const FVector& Location, FString Text, const FColor& Color, float LifeTime)
+{
+	PendingLabels.Add({ Location, MoveTemp(Text), Color, LifeTime });
+}
+
+bool UDebugDrawSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if ENABLE_DRAW_DEBUG
+	return Super::ShouldCreateSubsystem(Outer);
+#else
+	return false;
+#endif
+}
+
+void UDebugDrawSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	DrawLabelsHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateUObject(this, &UDebugDrawSubsystem::DrawLabels));
+}
+
+void UDebugDrawSubsystem::Deinitialize()
+{
+	UDebugDrawService::Unregister(DrawLabelsHandle);
+	DrawLabelsHandle.Reset();
+
+	ShapeCache.Empty();
+	PendingLines.Empty();
+	PendingTimedLines.Empty();
+	PendingLabels.Empty();
+	VisibleLabels.Empty();
+
+	Super::Deinitialize();
+}
+
+void UDebugDrawSubsystem::Tick(float DeltaTime)
+{
+	// tickables run after the actor tick groups, so everything queued this frame is in
+	if (!PendingLines.IsEmpty())
+	{
+		if (ULineBatchComponent* LineBatcher = GetWorld()->GetLineBatcher(UWorld::ELineBatcherType::World))
+		{
+			LineBatcher->DrawLines(PendingLines);
+		}
+		PendingLines.Reset();
+	}
+
+	// timed lines go to the persistent batcher so they age out on their own
+	if (!PendingTimedLines.IsEmpty())
+	{
+		if (ULineBatchComponent* PersistentLineBatcher = GetWorld()->GetLineBatcher(UWorld::ELineBatcherType::WorldPersistent))
+		{
+			PersistentLineBatcher->DrawLines(PendingTimedLines);
+		}
+		PendingTimedLines.Reset();
+	}
+
+	// labels from earlier frames stay until their lifetime runs out
+	VisibleLabels.RemoveAllSwap([DeltaTime](FLabel& Label)
+		{
+			Label.RemainingTime -= DeltaTime;
+			return Label.RemainingTime <= 0.f;
+		}, EAllowShrinking::No);
+
+	VisibleLabels.Append(MoveTemp(PendingLabels));
+	PendingLabels.Reset();
+}
+
+TStatId UDebugDrawSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDebugDrawSubsystem, STATGROUP_Tickables);
+}
+
+bool UDebugDrawSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+const TArray<FVector3f>& UDebugDrawSubsystem::GetShapeSegments(FShapeId Shape)
+{
+	if (const TArray<FVector3f>* Cached = ShapeCache.Find(Shape))
+	{
+		return *Cached;
+	}
+
+	// unpack the key
+	const EShapeType Type = static_cast<EShapeType>(Shape >> 56);
+	const int32 Segments = static_cast<int32>((Shape >> 32) & 0xFFFF);
+	const float AngleDeg = static_cast<float>(Shape & 0xFFFFFFFF) / 100.f;
+
+	TArray<FVector3f>& Out = ShapeCache.Add(Shape);
+
+	switch (Type)
+	{
+	case EShapeType::Sphere:
+		AddCircle(Out, FVector3f::ForwardVector, FVector3f::RightVector, Segments);
+		AddCircle(Out, FVector3f::ForwardVector, FVector3f::UpVector, Segments);
+		AddCircle(Out, FVector3f::RightVector, FVector3f::UpVector, Segments);
+		break;
+
+	case EShapeType::Arc:
+	{
+		const float HalfAngle = FMath::DegreesToRadians(AngleDeg * 0.5f);
+		FVector3f Previous;
+		for (int32 i = 0; i <= Segments; ++i)
+		{
+			const float Angle = -HalfAngle + 2.f * HalfAngle * i / Segments;
+			const FVector3f Point(FMath::Cos(Angle), FMath::Sin(Angle), 0.f);
+			if (i > 0)
+			{
+				Out.Add(Previous);
+				Out.Add(Point);
+			}
+			Previous = Point;
+		}
+
+		// edges and center line
+		Out.Add(FVector3f::ZeroVector); Out.Add(FVector3f(FMath::Cos(HalfAngle), FMath::Sin(HalfAngle), 0.f));
+		Out.Add(FVector3f::ZeroVector); Out.Add(FVector3f(FMath::Cos(HalfAngle), -FMath::Sin(HalfAngle), 0.f));
+		Out.Add(FVector3f::ZeroVector); Out.Add(FVector3f::ForwardVector);
+		break;
+	}
+
+	case EShapeType::Cone:
+	{
+		const float HalfAngle = FMath::DegreesToRadians(AngleDeg);
+		const float CosHalf = FMath::Cos(HalfAngle);
+		const float SinHalf = FMath::Sin(HalfAngle);
+
+		for (int32 i = 0; i < Segments; ++i)
+		{
+			const float Angle1 = UE_TWO_PI * i / Segments;
+			const float Angle2 = UE_TWO_PI * (i + 1) / Segments;
+			const FVector3f Rim1(CosHalf, SinHalf * FMath::Cos(Angle1), SinHalf * FMath::Sin(Angle1));
+			const FVector3f Rim2(CosHalf, SinHalf * FMath::Cos(Angle2), SinHalf * FMath::Sin(Angle2));
+
+			// side line from the apex and a rim segment
+			Out.Add(FVector3f::ZeroVector); Out.Add(Rim1);
+			Out.Add(Rim1); Out.Add(Rim2);
+		}
+		break;
+	}
+	}
+
+	return Out;
+}
+
+void UDebugDrawSubsystem::DrawLabels(UCanvas* Canvas, APlayerController* PlayerController)
+{
+	if (!Canvas || !Canvas->SceneView || VisibleLabels.IsEmpty())
+	{
+		return;
+	}
+
+	// the draw service is global, only draw into views of our own world
+	if (!PlayerController || PlayerController->GetWorld() != GetWorld())
+	{
+		return;
+	}
+
+	const FVector ViewOrigin = Canvas->SceneView->ViewMatrices.GetViewOrigin();
+	const FVector ViewDirection = Canvas->SceneView->GetViewDirection();
+	UFont* Font = GEngine->GetSmallFont();
+
+	for (const FLabel& Label : VisibleLabels)
+	{
+		// skip labels behind the camera
+		if (FVector::DotProduct(Label.Location - ViewOrigin, ViewDirection) <= 0.f)
+		{
+			continue;
+		}
+
+		const FVector ScreenLocation = Canvas->Project(Label.Location);
+
+		float TextWidth = 0.f;
+		float TextHeight = 0.f;
+		Canvas->TextSize(Font, Label.Text, TextWidth, TextHeight);
+
+		Canvas->SetDrawColor(Label.Color);
+		Canvas->DrawText(Font, Label.Text, ScreenLocation.X - TextWidth * 0.5f, ScreenLocation.Y - TextHeight * 0.5f);
+	}
+}
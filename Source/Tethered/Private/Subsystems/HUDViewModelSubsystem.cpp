@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/HUDViewModelSubsystem.h"
+#include "UI/HUDViewModel.h"
+
+void UHUDViewModelSubsystem::Enqueue(FHUDViewModel& ViewModel)
+{
+	if (ViewModel.QueuedIn.Get() == this)
+	{
+		return;
+	}
+
+	ViewModel.QueuedIn = this;
+	Pending.Add(&ViewModel);
+}
+
+void UHUDViewModelSubsystem::Cancel(FHUDViewModel& ViewModel)
+{
+	if (ViewModel.QueuedIn.Get() == this)
+	{
+		Pending.RemoveSingleSwap(&ViewModel, EAllowShrinking::No);
+		ViewModel.QueuedIn.Reset();
+	}
+}
+
+void UHUDViewModelSubsystem::Deinitialize()
+{
+	for (FHUDViewModel* ViewModel : Pending)
+	{
+		ViewModel->QueuedIn.Reset();
+	}
+	Pending.Empty();
+	Flushing.Empty();
+
+	Super::Deinitialize();
+}
+
+void UHUDViewModelSubsystem::Tick(float DeltaTime)
+{
+	// take the queue first so refreshes can dirty models again for the next frame
+	Swap(Pending, Flushing);
+
+	for (FHUDViewModel* ViewModel : Flushing)
+	{
+		ViewModel->QueuedIn.Reset();
+		ViewModel->Refresh();
+	}
+
+	Flushing.Reset();
+}
+
+TStatId UHUDViewModelSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHUDViewModelSubsystem, STATGROUP_Tickables);
+}
+
+bool UHUDViewModelSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,508 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/HurtboxRegistrySubsystem.h"
+#include "Gameplay/CombatCollision.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "Math/VectorRegister.h"
+
+DECLARE_CYCLE_STAT(TEXT("Hurtbox Sweep"), STAT_Hurtbox_Sweep, STATGROUP_Game);
+DECLARE_CYCLE_STAT(TEXT("Hurtbox Refit"), STAT_Hurtbox_Refit, STATGROUP_Game);
+
+bool UHurtboxRegistrySubsystem::bRegistryEnabled = true;
+
+namespace
+{
+	/** Padding lanes sit this far away so they never touch a query */
+	constexpr float PaddingCoordinate = 1.0e18f;
+
+	/** Returns the dot product of two lane-wise 3D vectors */
+	FORCEINLINE VectorRegister4Float Dot3(const VectorRegister4Float& AX, const VectorRegister4Float& AY, const VectorRegister4Float& AZ,
+		const VectorRegister4Float& BX, const VectorRegister4Float& BY, const VectorRegister4Float& BZ)
+	{
+		return VectorMultiplyAdd(AX, BX, VectorMultiplyAdd(AY, BY, VectorMultiply(AZ, BZ)));
+	}
+
+	/** Returns 1 / X in lanes where X is meaningfully positive, 0 elsewhere */
+	FORCEINLINE VectorRegister4Float SafeReciprocal(const VectorRegister4Float& X)
+	{
+		return VectorSelect(VectorCompareGT(X, VectorSetFloat1(UE_KINDA_SMALL_NUMBER)), VectorDivide(VectorOneFloat(), X), VectorZeroFloat());
+	}
+
+	/** Clamps every lane to [0, 1] */
+	FORCEINLINE VectorRegister4Float Saturate(const VectorRegister4Float& X)
+	{
+		return VectorMin(VectorMax(X, VectorZeroFloat()), VectorOneFloat());
+	}
+
+	/**
+	 *  Tests four capsules against a swept sphere. Returns one bit per lane whose capsule touches the sweep.
+	 *  This is the clamped closest points between two segments, written without branches so the degenerate
+	 *  cases (sphere shaped capsules, stationary sweeps) fall out of the safe reciprocals.
+	 */
+	int32 SweepLeaf(const float* AX, const float* AY, const float* AZ, const float* BX, const float* BY, const float* BZ, const float* R,
+		const FVector3f& Start, const FVector3f& Delta, float QueryRadius)
+	{
+		// capsule segments, one per lane
+		const VectorRegister4Float Ax = VectorLoadAligned(AX);
+		const VectorRegister4Float Ay = VectorLoadAligned(AY);
+		const VectorRegister4Float Az = VectorLoadAligned(AZ);
+		const VectorRegister4Float D1x = VectorSubtract(VectorLoadAligned(BX), Ax);
+		const VectorRegister4Float D1y = VectorSubtract(VectorLoadAligned(BY), Ay);
+		const VectorRegister4Float D1z = VectorSubtract(VectorLoadAligned(BZ), Az);
+
+		// sweep segment, the same in every lane
+		const VectorRegister4Float D2x = VectorSetFloat1(Delta.X);
+		const VectorRegister4Float D2y = VectorSetFloat1(Delta.Y);
+		const VectorRegister4Float D2z = VectorSetFloat1(Delta.Z);
+
+		// capsule start relative to sweep start
+		const VectorRegister4Float Rx = VectorSubtract(Ax, VectorSetFloat1(Start.X));
+		const VectorRegister4Float Ry = VectorSubtract(Ay, VectorSetFloat1(Start.Y));
+		const VectorRegister4Float Rz = VectorSubtract(Az, VectorSetFloat1(Start.Z));
+
+		const VectorRegister4Float A = Dot3(D1x, D1y, D1z, D1x, D1y, D1z);
+		const VectorRegister4Float B = Dot3(D1x, D1y, D1z, D2x, D2y, D2z);
+		const VectorRegister4Float C = Dot3(D1x, D1y, D1z, Rx, Ry, Rz);
+		const VectorRegister4Float E = VectorSetFloat1(Delta.SizeSquared());
+		const VectorRegister4Float F = Dot3(D2x, D2y, D2z, Rx, Ry, Rz);
+
+		// parameter on the capsule for the infinite lines, then on the sweep, then back on the capsule after clamping
+		const VectorRegister4Float Denom = VectorSubtract(VectorMultiply(A, E), VectorMultiply(B, B));
+		VectorRegister4Float S = Saturate(VectorMultiply(VectorSubtract(VectorMultiply(B, F), VectorMultiply(C, E)), SafeReciprocal(Denom)));
+		const VectorRegister4Float T = Saturate(VectorMultiply(VectorMultiplyAdd(B, S, F), SafeReciprocal(E)));
+		S = Saturate(VectorMultiply(VectorSubtract(VectorMultiply(B, T), C), SafeReciprocal(A)));
+
+		// vector between the closest points
+		const VectorRegister4Float Px = VectorSubtract(VectorMultiplyAdd(D1x, S, Rx), VectorMultiply(D2x, T));
+		const VectorRegister4Float Py = VectorSubtract(VectorMultiplyAdd(D1y, S, Ry), VectorMultiply(D2y, T));
+		const VectorRegister4Float Pz = VectorSubtract(VectorMultiplyAdd(D1z, S, Rz), VectorMultiply(D2z, T));
+
+		const VectorRegister4Float Reach = VectorAdd(VectorLoadAligned(R), VectorSetFloat1(QueryRadius));
+		return VectorMaskBits(VectorCompareLE(Dot3(Px, Py, Pz, Px, Py, Pz), VectorMultiply(Reach, Reach)));
+	}
+
+	/** Scalar closest points between a capsule segment and the sweep, for filling in a confirmed hit */
+	void ClosestPoints(const FVector3f& A, const FVector3f& B, const FVector3f& Start, const FVector3f& Delta, FVector3f& OutOnCapsule, FVector3f& OutOnSweep, float& OutTime)
+	{
+		const FVector3f D1 = B - A;
+		const FVector3f R = A - Start;
+		const float a = D1.SizeSquared();
+		const float b = D1 | Delta;
+		const float c = D1 | R;
+		const float e = Delta.SizeSquared();
+		const float f = Delta | R;
+
+		const float Denom = a * e - b * b;
+		float s = Denom > UE_KINDA_SMALL_NUMBER ? FMath::Clamp((b * f - c * e) / Denom, 0.f, 1.f) : 0.f;
+		const float t = e > UE_KINDA_SMALL_NUMBER ? FMath::Clamp((b * s + f) / e, 0.f, 1.f) : 0.f;
+		s = a > UE_KINDA_SMALL_NUMBER ? FMath::Clamp((b * t - c) / a, 0.f, 1.f) : 0.f;
+
+		OutOnCapsule = A + D1 * s;
+		OutOnSweep = Start + Delta * t;
+		OutTime = t;
+	}
+}
+
+void UHurtboxRegistrySubsystem::RegisterHurtbox(UPrimitiveComponent* Component, EHurtboxFaction Faction)
+{
+	if (!IsValid(Component) || !Component->GetOwner() || Faction == EHurtboxFaction::None)
+	{
+		return;
+	}
+
+	// ignore duplicate registrations
+	if (EntryIndices.Contains(Component))
+	{
+		return;
+	}
+
+	FEntry& NewEntry = Entries.AddDefaulted_GetRef();
+	NewEntry.Component = Component;
+	NewEntry.ComponentKey = Component;
+	NewEntry.Actor = Component->GetOwner();
+	NewEntry.Faction = Faction;
+
+	EntryIndices.Add(Component, Entries.Num() - 1);
+	bTopologyDirty = true;
+}
+
+void UHurtboxRegistrySubsystem::UnregisterHurtbox(UPrimitiveComponent* Component)
+{
+	if (const int32* Index = EntryIndices.Find(Component))
+	{
+		RemoveEntryAt(*Index);
+	}
+}
+
+bool UHurtboxRegistrySubsystem::SweepSphere(const FVector& Start, const FVector& End, float Radius, EHurtboxFaction Factions, const AActor* IgnoreActor, TArray<FHitResult>& OutHits)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Hurtbox_Sweep);
+
+	OutHits.Reset();
+
+	RefitIfNeeded();
+	if (Nodes.IsEmpty())
+	{
+		return false;
+	}
+
+	const FVector3f SweepStart(Start);
+	const FVector3f SweepDelta = FVector3f(End) - SweepStart;
+	const FVector3f QueryMin = FVector3f::Min(SweepStart, SweepStart + SweepDelta) - FVector3f(Radius);
+	const FVector3f QueryMax = FVector3f::Max(SweepStart, SweepStart + SweepDelta) + FVector3f(Radius);
+
+	Stack.Reset();
+	Stack.Add(0);
+
+	while (!Stack.IsEmpty())
+	{
+		const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+
+		// skip subtrees of the wrong faction or outside the swept bounds
+		if (!EnumHasAnyFlags(Node.Factions, Factions)
+			|| Node.Min.X > QueryMax.X || Node.Max.X < QueryMin.X
+			|| Node.Min.Y > QueryMax.Y || Node.Max.Y < QueryMin.Y
+			|| Node.Min.Z > QueryMax.Z || Node.Max.Z < QueryMin.Z)
+		{
+			continue;
+		}
+
+		if (!Node.IsLeaf())
+		{
+			Stack.Add(Node.Left);
+			Stack.Add(Node.Right);
+			continue;
+		}
+
+		const int32 First = Node.FirstSlot;
+		int32 LaneMask = SweepLeaf(&AX[First], &AY[First], &AZ[First], &BX[First], &BY[First], &BZ[First], &R[First], SweepStart, SweepDelta, Radius);
+
+		while (LaneMask != 0)
+		{
+			const int32 Slot = First + FMath::CountTrailingZeros(static_cast<uint32>(LaneMask));
+			LaneMask &= LaneMask - 1;
+
+			const int32 EntryIndex = SlotEntries[Slot];
+			if (EntryIndex == INDEX_NONE || !EnumHasAnyFlags(Entries[EntryIndex].Faction, Factions))
+			{
+				continue;
+			}
+
+			const FEntry& Entry = Entries[EntryIndex];
+			AActor* Actor = Entry.Actor.Get();
+			if (!Actor || Actor == IgnoreActor)
+			{
+				continue;
+			}
+
+			// fill in the hit the same way a sphere sweep would report an overlap
+			FVector3f OnCapsule, OnSweep;
+			float Time;
+			ClosestPoints(FVector3f(AX[Slot], AY[Slot], AZ[Slot]), FVector3f(BX[Slot], BY[Slot], BZ[Slot]), SweepStart, SweepDelta, OnCapsule, OnSweep, Time);
+
+			FVector3f Normal = (OnSweep - OnCapsule).GetSafeNormal();
+			if (Normal.IsZero())
+			{
+				Normal = -SweepDelta.GetSafeNormal();
+				if (Normal.IsZero())
+				{
+					Normal = FVector3f::UpVector;
+				}
+			}
+
+			FHitResult& Hit = OutHits.AddDefaulted_GetRef();
+			Hit.HitObjectHandle = FActorInstanceHandle(Actor);
+			Hit.Component = Entry.Component;
+			Hit.Time = Time;
+			Hit.Distance = Time * SweepDelta.Size();
+			Hit.TraceStart = Start;
+			Hit.TraceEnd = End;
+			Hit.Location = FVector(OnSweep);
+			Hit.ImpactPoint = FVector(OnCapsule + Normal * R[Slot]);
+			Hit.Normal = FVector(Normal);
+			Hit.ImpactNormal = FVector(Normal);
+		}
+	}
+
+	// report hits in sweep order, like the physics query does
+	OutHits.Sort([](const FHitResult& A, const FHitResult& B) { return A.Time < B.Time; });
+
+	return !OutHits.IsEmpty();
+}
+
+bool UHurtboxRegistrySubsystem::SweepMelee(UWorld& World, const FVector& Start, const FVector& End, float Radius, EHurtboxFaction Factions, const AActor* IgnoreActor, TArray<FHitResult>& OutHits)
+{
+	if (bRegistryEnabled)
+	{
+		if (UHurtboxRegistrySubsystem* Registry = World.GetSubsystem<UHurtboxRegistrySubsystem>())
+		{
+			return Registry->SweepSphere(Start, End, Radius, Factions, IgnoreActor, OutHits);
+		}
+	}
+
+	// physics fallback through the faction collision channels
+	FCollisionObjectQueryParams ObjectParams;
+	if (EnumHasAnyFlags(Factions, EHurtboxFaction::Player))
+	{
+		ObjectParams.AddObjectTypesToQuery(CombatCollision::PlayerHurtbox);
+	}
+	if (EnumHasAnyFlags(Factions, EHurtboxFaction::Enemy))
+	{
+		ObjectParams.AddObjectTypesToQuery(CombatCollision::EnemyHurtbox);
+	}
+	if (EnumHasAnyFlags(Factions, EHurtboxFaction::Prop))
+	{
+		ObjectParams.AddObjectTypesToQuery(ECC_PhysicsBody);
+	}
+
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MeleeSweep), false, IgnoreActor);
+	World.SweepMultiByObjectType(OutHits, Start, End, FQuat::Identity, ObjectParams, FCollisionShape::MakeSphere(Radius), QueryParams);
+
+	return !OutHits.IsEmpty();
+}
+
+void UHurtboxRegistrySubsystem::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndices.Empty();
+	Nodes.Empty();
+	SlotEntries.Empty();
+	AX.Empty(); AY.Empty(); AZ.Empty();
+	BX.Empty(); BY.Empty(); BZ.Empty();
+	R.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UHurtboxRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHurtboxRegistrySubsystem::RefitIfNeeded()
+{
+	// transforms only need sampling once per frame; membership changes force a rebuild right away
+	if (LastRefitFrame == GFrameCounter && !bTopologyDirty)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_Hurtbox_Refit);
+
+	LastRefitFrame = GFrameCounter;
+
+	// drop hurtboxes whose component went away without unregistering
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Entries[Index].Component.IsValid())
+		{
+			RemoveEntryAt(Index);
+		}
+	}
+
+	if (bTopologyDirty || ++RefitsSinceBuild >= RebuildInterval)
+	{
+		Build();
+	}
+
+	for (const FEntry& Entry : Entries)
+	{
+		SampleEntry(Entry);
+	}
+
+	// children always follow their parent, so walking backwards refits bottom up
+	for (int32 NodeIndex = Nodes.Num() - 1; NodeIndex >= 0; --NodeIndex)
+	{
+		FNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			RefitLeaf(Node);
+		}
+		else
+		{
+			Node.Min = FVector3f::Min(Nodes[Node.Left].Min, Nodes[Node.Right].Min);
+			Node.Max = FVector3f::Max(Nodes[Node.Left].Max, Nodes[Node.Right].Max);
+		}
+	}
+}
+
+void UHurtboxRegistrySubsystem::Build()
+{
+	bTopologyDirty = false;
+	RefitsSinceBuild = 0;
+
+	Nodes.Reset();
+	SlotEntries.Reset();
+
+	if (Entries.IsEmpty())
+	{
+		return;
+	}
+
+	// split on the current bounds centers
+	TArray<FVector3f> Centers;
+	Centers.SetNumUninitialized(Entries.Num());
+	BuildOrder.SetNumUninitialized(Entries.Num());
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		Centers[Index] = FVector3f(Entries[Index].Component->Bounds.Origin);
+		BuildOrder[Index] = Index;
+	}
+
+	BuildNode(0, Entries.Num(), Centers);
+
+	// padding lanes are parked far away, every other lane is written by the refit
+	const int32 NumSlots = SlotEntries.Num();
+	for (TArray<float, TAlignedHeapAllocator<16>>* Lane : { &AX, &AY, &AZ, &BX, &BY, &BZ, &R })
+	{
+		Lane->SetNumUninitialized(NumSlots);
+	}
+
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		if (SlotEntries[Slot] == INDEX_NONE)
+		{
+			AX[Slot] = AY[Slot] = AZ[Slot] = BX[Slot] = BY[Slot] = BZ[Slot] = PaddingCoordinate;
+			R[Slot] = 0.f;
+		}
+	}
+}
+
+int32 UHurtboxRegistrySubsystem::BuildNode(int32 Begin, int32 End, const TArray<FVector3f>& Centers)
+{
+	const int32 NodeIndex = Nodes.AddDefaulted();
+	const int32 Count = End - Begin;
+
+	// factions are fixed per entry, so they can be gathered once per build
+	EHurtboxFaction Factions = EHurtboxFaction::None;
+	for (int32 i = Begin; i < End; ++i)
+	{
+		Factions |= Entries[BuildOrder[i]].Faction;
+	}
+	Nodes[NodeIndex].Factions = Factions;
+
+	if (Count <= LeafSize)
+	{
+		const int32 FirstSlot = SlotEntries.Num();
+		SlotEntries.AddUninitialized(LeafSize);
+		for (int32 Lane = 0; Lane < LeafSize; ++Lane)
+		{
+			const int32 EntryIndex = Lane < Count ? BuildOrder[Begin + Lane] : INDEX_NONE;
+			SlotEntries[FirstSlot + Lane] = EntryIndex;
+			if (EntryIndex != INDEX_NONE)
+			{
+				Entries[EntryIndex].Slot = FirstSlot + Lane;
+			}
+		}
+
+		Nodes[NodeIndex].FirstSlot = FirstSlot;
+		return NodeIndex;
+	}
+
+	// median split along the widest axis of the centers
+	FVector3f CenterMin = Centers[BuildOrder[Begin]];
+	FVector3f CenterMax = CenterMin;
+	for (int32 i = Begin + 1; i < End; ++i)
+	{
+		CenterMin = FVector3f::Min(CenterMin, Centers[BuildOrder[i]]);
+		CenterMax = FVector3f::Max(CenterMax, Centers[BuildOrder[i]]);
+	}
+
+	const FVector3f Extent = CenterMax - CenterMin;
+	const int32 Axis = Extent.X >= Extent.Y ? (Extent.X >= Extent.Z ? 0 : 2) : (Extent.Y >= Extent.Z ? 1 : 2);
+
+	TArrayView<int32>(BuildOrder.GetData() + Begin, Count).Sort([&Centers, Axis](int32 A, int32 B) { return Centers[A][Axis] < Centers[B][Axis]; });
+
+	// keep the left side a whole number of leaves so leaves stay full
+	const int32 Mid = Begin + FMath::Max(LeafSize, (Count / 2 / LeafSize) * LeafSize);
+
+	const int32 Left = BuildNode(Begin, Mid, Centers);
+	const int32 Right = BuildNode(Mid, End, Centers);
+	Nodes[NodeIndex].Left = Left;
+	Nodes[NodeIndex].Right = Right;
+
+	return NodeIndex;
+}
+
+void UHurtboxRegistrySubsystem::SampleEntry(const FEntry& Entry)
+{
+	const UPrimitiveComponent* Component = Entry.Component.Get();
+	if (!Component || Entry.Slot == INDEX_NONE)
+	{
+		return;
+	}
+
+	FVector A, B;
+	float Radius;
+
+	if (const UCapsuleComponent* Capsule = Cast<UCapsuleComponent>(Component))
+	{
+		// capsules are used exactly
+		Radius = Capsule->GetScaledCapsuleRadius();
+		const FVector HalfSegment = Capsule->GetUpVector() * Capsule->GetScaledCapsuleHalfHeight_WithoutHemisphere();
+		A = Capsule->GetComponentLocation() - HalfSegment;
+		B = Capsule->GetComponentLocation() + HalfSegment;
+	}
+	else
+	{
+		// anything else becomes a capsule along the longest axis of its world bounds.
+		// the radius reaches the corners of the cross section and the segment runs the full length,
+		// so the capsule encloses the box instead of clipping its edges
+		const FBoxSphereBounds& Bounds = Component->Bounds;
+		const FVector& Extent = Bounds.BoxExtent;
+		const int32 Axis = Extent.X >= Extent.Y ? (Extent.X >= Extent.Z ? 0 : 2) : (Extent.Y >= Extent.Z ? 1 : 2);
+
+		Radius = static_cast<float>(FMath::Sqrt(FMath::Square(Extent[(Axis + 1) % 3]) + FMath::Square(Extent[(Axis + 2) % 3])));
+
+		FVector HalfSegment = FVector::ZeroVector;
+		HalfSegment[Axis] = Extent[Axis];
+		A = Bounds.Origin - HalfSegment;
+		B = Bounds.Origin + HalfSegment;
+	}
+
+	const int32 Slot = Entry.Slot;
+	AX[Slot] = static_cast<float>(A.X);
+	AY[Slot] = static_cast<float>(A.Y);
+	AZ[Slot] = static_cast<float>(A.Z);
+	BX[Slot] = static_cast<float>(B.X);
+	BY[Slot] = static_cast<float>(B.Y);
+	BZ[Slot] = static_cast<float>(B.Z);
+	R[Slot] = Radius;
+}
+
+void UHurtboxRegistrySubsystem::RefitLeaf(FNode& Node) const
+{
+	Node.Min = FVector3f(UE_BIG_NUMBER);
+	Node.Max = FVector3f(-UE_BIG_NUMBER);
+
+	for (int32 Slot = Node.FirstSlot; Slot < Node.FirstSlot + LeafSize; ++Slot)
+	{
+		if (SlotEntries[Slot] == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FVector3f A(AX[Slot], AY[Slot], AZ[Slot]);
+		const FVector3f B(BX[Slot], BY[Slot], BZ[Slot]);
+		Node.Min = FVector3f::Min(Node.Min, FVector3f::Min(A, B) - FVector3f(R[Slot]));
+		Node.Max = FVector3f::Max(Node.Max, FVector3f::Max(A, B) + FVector3f(R[Slot]));
+	}
+}
+
+void UHurtboxRegistrySubsystem::RemoveEntryAt(int32 Index)
+{
+	// the cached key stays valid for lookup even after the component is gone
+	EntryIndices.Remove(Entries[Index].ComponentKey);
+	Entries.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	// fix up the lookup for the entry that moved into the gap
+	if (Entries.IsValidIndex(Index))
+	{
+		EntryIndices.Add(Entries[Index].ComponentKey, Index);
+	}
+
+	bTopologyDirty = true;
+}
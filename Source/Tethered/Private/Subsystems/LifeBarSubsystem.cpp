@@ -0,0 +1,189 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/LifeBarSubsystem.h"
+#include "UI/LifeBarLayer.h"
+#include "Components/SceneComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "SceneView.h"
+
+// Draw order of the life bar layer in the viewport, below the game UI
+static constexpr int32 LifeBarLayerZOrder = -1;
+
+int32 ULifeBarSubsystem::RegisterLifeBar(USceneComponent* Anchor, const FVector& Offset, const FLinearColor& Color)
+{
+	if (!Anchor)
+	{
+		return INDEX_NONE;
+	}
+
+	// reuse a released slot before growing
+	const int32 Handle = FreeSlots.IsEmpty() ? Bars.AddDefaulted() : FreeSlots.Pop(EAllowShrinking::No);
+
+	FLifeBar& Bar = Bars[Handle];
+	Bar.Anchor = Anchor;
+	Bar.Offset = Offset;
+	Bar.Color = Color;
+	Bar.Percent = 1.0f;
+	Bar.bVisible = true;
+	Bar.bInUse = true;
+
+	return Handle;
+}
+
+void ULifeBarSubsystem::UnregisterLifeBar(int32& Handle)
+{
+	if (Bars.IsValidIndex(Handle) && Bars[Handle].bInUse)
+	{
+		Bars[Handle] = FLifeBar();
+		FreeSlots.Add(Handle);
+	}
+
+	Handle = INDEX_NONE;
+}
+
+void ULifeBarSubsystem::SetLifePercentage(int32 Handle, float Percent)
+{
+	if (Bars.IsValidIndex(Handle))
+	{
+		Bars[Handle].Percent = FMath::Clamp(Percent, 0.0f, 1.0f);
+	}
+}
+
+void ULifeBarSubsystem::SetBarColor(int32 Handle, const FLinearColor& Color)
+{
+	if (Bars.IsValidIndex(Handle))
+	{
+		Bars[Handle].Color = Color;
+	}
+}
+
+void ULifeBarSubsystem::SetLifeBarVisible(int32 Handle, bool bVisible)
+{
+	if (Bars.IsValidIndex(Handle))
+	{
+		Bars[Handle].bVisible = bVisible;
+	}
+}
+
+void ULifeBarSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// one layer for the whole world; dedicated servers have no viewport and never draw
+	if (UGameViewportClient* ViewportClient = InWorld.GetGameViewport())
+	{
+		Layer = SNew(SLifeBarLayer).Subsystem(this);
+		ViewportClient->AddViewportWidgetContent(Layer.ToSharedRef(), LifeBarLayerZOrder);
+	}
+}
+
+void ULifeBarSubsystem::Deinitialize()
+{
+	if (Layer.IsValid())
+	{
+		if (UGameViewportClient* ViewportClient = GetWorld()->GetGameViewport())
+		{
+			ViewportClient->RemoveViewportWidgetContent(Layer.ToSharedRef());
+		}
+		Layer.Reset();
+	}
+
+	Bars.Empty();
+	FreeSlots.Empty();
+	ProjectedBars.Empty();
+
+	Super::Deinitialize();
+}
+
+void ULifeBarSubsystem::Tick(float DeltaTime)
+{
+	ProjectedBars.Reset();
+
+	if (Layer.IsValid())
+	{
+		ProjectBars();
+	}
+}
+
+void ULifeBarSubsystem::ProjectBars()
+{
+	const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	if (!GameInstance)
+	{
+		return;
+	}
+
+	// every local player sees the bars from their own camera, in their own part of the viewport
+	const TArray<ULocalPlayer*>& LocalPlayers = GameInstance->GetLocalPlayers();
+	for (ULocalPlayer* LocalPlayer : LocalPlayers)
+	{
+		if (LocalPlayer && LocalPlayer->PlayerController && LocalPlayer->ViewportClient)
+		{
+			ProjectBarsForPlayer(*LocalPlayer, LocalPlayers.Num() > 1);
+		}
+	}
+}
+
+void ULifeBarSubsystem::ProjectBarsForPlayer(ULocalPlayer& LocalPlayer, bool bSplitScreen)
+{
+	// one view projection for every bar, instead of one per ProjectWorldLocationToScreen call
+	FSceneViewProjectionData ProjectionData;
+	if (!LocalPlayer.GetProjectionData(LocalPlayer.ViewportClient->Viewport, ProjectionData))
+	{
+		return;
+	}
+
+	const FMatrix ViewProjection = ProjectionData.ComputeViewProjectionMatrix();
+	const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+	const FVector ViewOrigin = ProjectionData.ViewOrigin;
+	const double MaxDistanceSquared = FMath::Square(static_cast<double>(MaxDrawDistance));
+
+	// keep bars whose edges are still on screen. In split screen the margin would spill into the
+	// neighbouring view, so bars are cut at the view's edge instead
+	const FVector2D Margin = bSplitScreen ? FVector2D::ZeroVector : FVector2D(BarSize.X, BarSize.Y);
+	const FBox2D ScreenBounds(FVector2D(ViewRect.Min) - Margin, FVector2D(ViewRect.Max) + Margin);
+
+	for (const FLifeBar& Bar : Bars)
+	{
+		if (!Bar.bInUse || !Bar.bVisible)
+		{
+			continue;
+		}
+
+		const USceneComponent* Anchor = Bar.Anchor.Get();
+		if (!Anchor)
+		{
+			continue;
+		}
+
+		// distance culling
+		const FVector WorldLocation = Anchor->GetComponentLocation() + Bar.Offset;
+		if (FVector::DistSquared(WorldLocation, ViewOrigin) > MaxDistanceSquared)
+		{
+			continue;
+		}
+
+		// frustum culling: behind the camera fails the projection, off to the sides fails the bounds
+		FVector2D ScreenPosition;
+		if (!FSceneView::ProjectWorldToScreen(WorldLocation, ViewRect, ViewProjection, ScreenPosition) || !ScreenBounds.IsInsideOrOn(ScreenPosition))
+		{
+			continue;
+		}
+
+		ProjectedBars.Add({ FVector2f(ScreenPosition), Bar.Percent, Bar.Color });
+	}
+}
+
+TStatId ULifeBarSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULifeBarSubsystem, STATGROUP_Tickables);
+}
+
+bool ULifeBarSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
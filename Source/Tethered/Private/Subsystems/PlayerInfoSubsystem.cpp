@@ -0,0 +1,72 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/PlayerInfoSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+const TArray<FPlayerInfo>& UPlayerInfoSubsystem::GetPlayers()
+{
+	RefreshIfStale();
+	return Players;
+}
+
+const FPlayerInfo* UPlayerInfoSubsystem::FindNearestPlayer(const FVector& Point, float* OutDistance)
+{
+	RefreshIfStale();
+
+	// there's only ever a handful of players, so a linear scan over the snapshot beats any spatial structure
+	const FPlayerInfo* Nearest = nullptr;
+	double NearestDistSq = UE_DOUBLE_BIG_NUMBER;
+
+	for (const FPlayerInfo& Player : Players)
+	{
+		const double DistSq = FVector::DistSquared(Player.Location, Point);
+		if (DistSq < NearestDistSq)
+		{
+			NearestDistSq = DistSq;
+			Nearest = &Player;
+		}
+	}
+
+	if (OutDistance && Nearest)
+	{
+		*OutDistance = FMath::Sqrt(NearestDistSq);
+	}
+
+	return Nearest;
+}
+
+bool UPlayerInfoSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPlayerInfoSubsystem::RefreshIfStale()
+{
+	if (SnapshotFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	SnapshotFrame = GFrameCounter;
+	Players.Reset();
+
+	// controller iteration order is the same order GetPlayerController indexes into
+	int32 PlayerIndex = 0;
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator, ++PlayerIndex)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (!IsValid(Pawn))
+		{
+			continue;
+		}
+
+		FPlayerInfo& Player = Players.AddDefaulted_GetRef();
+		Player.Pawn = Pawn;
+		Player.Location = Pawn->GetActorLocation();
+		Player.Velocity = Pawn->GetVelocity();
+		Player.PlayerIndex = PlayerIndex;
+	}
+}
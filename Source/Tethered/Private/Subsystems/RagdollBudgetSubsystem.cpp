@@ -0,0 +1,166 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Subsystems/RagdollBudgetSubsystem.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_STATS_GROUP(TEXT("Ragdolls"), STATGROUP_Ragdolls, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Ragdolls"), STAT_Ragdolls_Active, STATGROUP_Ragdolls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Frozen Ragdolls"), STAT_Ragdolls_Frozen, STATGROUP_Ragdolls);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ragdoll Budget"), STAT_Ragdolls_Budget, STATGROUP_Ragdolls);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Freezes Over Budget"), STAT_Ragdolls_FrozenOverBudget, STATGROUP_Ragdolls);
+
+int32 URagdollBudgetSubsystem::MaxActiveRagdolls = 6;
+
+void URagdollBudgetSubsystem::RegisterRagdoll(USkeletalMeshComponent* Mesh, bool bCanFreeze)
+{
+	if (!Mesh)
+	{
+		return;
+	}
+
+	// registering again restarts the ragdoll, e.g. a respawned player dying a second time
+	UnregisterRagdoll(Mesh);
+
+	FRagdoll& Ragdoll = Ragdolls.AddDefaulted_GetRef();
+	Ragdoll.Mesh = Mesh;
+	Ragdoll.StartTime = GetWorld()->GetTimeSeconds();
+	Ragdoll.bCanFreeze = bCanFreeze;
+
+	// make room right away so a crowd dying in one frame never simulates all at once
+	EnforceBudget();
+}
+
+void URagdollBudgetSubsystem::UnregisterRagdoll(USkeletalMeshComponent* Mesh)
+{
+	const int32 Index = Ragdolls.IndexOfByPredicate([Mesh](const FRagdoll& Ragdoll) { return Ragdoll.Mesh.Get() == Mesh; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// hand the skeleton back to animation
+	if (Ragdolls[Index].bFrozen)
+	{
+		Mesh->bNoSkeletonUpdate = false;
+	}
+
+	Ragdolls.RemoveAt(Index, EAllowShrinking::No);
+}
+
+int32 URagdollBudgetSubsystem::GetNumActiveRagdolls() const
+{
+	int32 NumActive = 0;
+	for (const FRagdoll& Ragdoll : Ragdolls)
+	{
+		NumActive += Ragdoll.bFrozen ? 0 : 1;
+	}
+	return NumActive;
+}
+
+void URagdollBudgetSubsystem::Deinitialize()
+{
+	Ragdolls.Empty();
+
+	Super::Deinitialize();
+}
+
+void URagdollBudgetSubsystem::Tick(float DeltaTime)
+{
+	// drop meshes that were destroyed with their actors
+	Ragdolls.RemoveAll([](const FRagdoll& Ragdoll) { return !Ragdoll.Mesh.IsValid(); });
+
+	// ragdolls at rest look the same frozen, and freezing them gives their budget back
+	for (FRagdoll& Ragdoll : Ragdolls)
+	{
+		if (!Ragdoll.bFrozen && Ragdoll.bCanFreeze && !Ragdoll.Mesh->RigidBodyIsAwake())
+		{
+			Freeze(Ragdoll);
+		}
+	}
+
+	// the budget may have been lowered since the last registration
+	EnforceBudget();
+
+	SET_DWORD_STAT(STAT_Ragdolls_Active, GetNumActiveRagdolls());
+	SET_DWORD_STAT(STAT_Ragdolls_Frozen, GetNumFrozenRagdolls());
+	SET_DWORD_STAT(STAT_Ragdolls_Budget, MaxActiveRagdolls);
+}
+
+TStatId URagdollBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URagdollBudgetSubsystem, STATGROUP_Tickables);
+}
+
+bool URagdollBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void URagdollBudgetSubsystem::Freeze(FRagdoll& Ragdoll)
+{
+	USkeletalMeshComponent* Mesh = Ragdoll.Mesh.Get();
+	Ragdoll.bFrozen = true;
+	if (!Mesh)
+	{
+		return;
+	}
+
+	// stop simulating and keep the bones where the simulation left them instead of returning to animation
+	Mesh->SetSimulatePhysics(false);
+	Mesh->bNoSkeletonUpdate = true;
+	Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+}
+
+void URagdollBudgetSubsystem::EnforceBudget()
+{
+	int32 NumActive = GetNumActiveRagdolls();
+	const int32 Budget = FMath::Max(MaxActiveRagdolls, 0);
+	if (NumActive <= Budget)
+	{
+		return;
+	}
+
+	// freeze the ragdolls the player is least likely to notice: farthest from the camera, or oldest without one
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	const bool bHasView = PlayerController && PlayerController->IsLocalController();
+	if (bHasView)
+	{
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	}
+
+	while (NumActive > Budget)
+	{
+		FRagdoll* Victim = nullptr;
+		double VictimScore = -UE_DOUBLE_BIG_NUMBER;
+
+		for (FRagdoll& Ragdoll : Ragdolls)
+		{
+			const USkeletalMeshComponent* Mesh = Ragdoll.Mesh.Get();
+			if (Ragdoll.bFrozen || !Ragdoll.bCanFreeze || !Mesh)
+			{
+				continue;
+			}
+
+			const double Score = bHasView ? FVector::DistSquared(Mesh->GetComponentLocation(), ViewLocation) : -Ragdoll.StartTime;
+			if (Score > VictimScore)
+			{
+				VictimScore = Score;
+				Victim = &Ragdoll;
+			}
+		}
+
+		// everything left is protected
+		if (!Victim)
+		{
+			return;
+		}
+
+		Freeze(*Victim);
+		INC_DWORD_STAT(STAT_Ragdolls_FrozenOverBudget);
+		--NumActive;
+	}
+}
@@ -0,0 +1,153 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/AimAssistScoring.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAimAssistScoringParityTest, "Tethered.AimAssist.Scoring.MatchesReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+namespace AimAssistScoringTest
+{
+	/** A candidate as the component used to see it, before it was packed into the SoA buffer */
+	struct FCandidate
+	{
+		FVector AimPoint;
+		FVector Velocity;
+		bool bIsCurrent;
+	};
+
+	/** Expected kernel outputs for a single candidate */
+	struct FExpected
+	{
+		float Dist2D;
+		float Dot2D;
+		float Score;
+	};
+
+	/**
+	 *  Independent reference for the kernels. This is the per-target scoring the component did before the SoA kernel,
+	 *  written against FVector2D on purpose so it shares no code with AimAssistScoring
+	 */
+	FExpected ScoreReference(const FCandidate& Candidate, const FVector& Origin, const FVector2D& Forward, const FAimAssistScoreWeights& Weights)
+	{
+		const FVector To = Candidate.AimPoint - Origin;
+		const FVector2D To2D(To.X, To.Y);
+
+		FExpected Expected;
+		Expected.Dist2D = static_cast<float>(To2D.Size());
+		Expected.Dot2D = static_cast<float>(FVector2D::DotProduct(Forward, To2D.GetSafeNormal()));
+
+		const FVector2D V2(Candidate.Velocity.X, Candidate.Velocity.Y);
+		const float VelAlign = V2.IsNearlyZero() ? 0.f : static_cast<float>(FVector2D::DotProduct(V2.GetSafeNormal(), Forward));
+
+		const float DistTerm = (Expected.Dist2D > KINDA_SMALL_NUMBER) ? (1.f / Expected.Dist2D) : 1.f;
+		const float Sticky = Candidate.bIsCurrent ? 1.f : 0.f;
+
+		Expected.Score = Weights.WDist * DistTerm + Weights.WAngle * Expected.Dot2D + Weights.WVel * VelAlign + Weights.WSticky * Sticky;
+		return Expected;
+	}
+
+	/** Makes random candidates around the origin, including the degenerate cases the kernel special-cases */
+	void MakeRandomCandidates(FRandomStream& Random, int32 Num, const FVector& Origin, TArray<FCandidate>& OutCandidates)
+	{
+		OutCandidates.Reset(Num);
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			// offsets are snapped to 1/8 cm so the aim points survive the SoA's float conversion exactly
+			FCandidate& Candidate = OutCandidates.AddDefaulted_GetRef();
+			Candidate.AimPoint = Origin + FVector(FMath::GridSnap(Random.FRandRange(-3000.f, 3000.f), 0.125f), FMath::GridSnap(Random.FRandRange(-3000.f, 3000.f), 0.125f), Random.FRandRange(-200.f, 200.f));
+			Candidate.Velocity = FVector(Random.FRandRange(-600.f, 600.f), Random.FRandRange(-600.f, 600.f), 0.f);
+			Candidate.bIsCurrent = i == Num / 2;
+
+			// candidates on top of the origin and stationary candidates take the fallback branches
+			if (i % 7 == 3)
+			{
+				Candidate.AimPoint = FVector(Origin.X, Origin.Y, Candidate.AimPoint.Z);
+			}
+
+			if (i % 5 == 1)
+			{
+				Candidate.Velocity = FVector::ZeroVector;
+			}
+		}
+	}
+
+	/** Relative tolerance, since distances run into the thousands while dots stay within [-1, 1] */
+	bool Matches(float Actual, float Expected)
+	{
+		return FMath::IsNearlyEqual(Actual, Expected, 1.e-4f * FMath::Max(1.f, FMath::Abs(Expected)));
+	}
+}
+
+bool FAimAssistScoringParityTest::RunTest(const FString& Parameters)
+{
+	using namespace AimAssistScoringTest;
+
+	FRandomStream Random(0x7E7E);
+
+	// counts that fill whole registers, leave a remainder, or never reach the SIMD loop at all
+	const int32 Counts[] = { 0, 1, 3, 4, 5, 7, 8, 13, 64, 67, 255, 256 };
+
+	for (const int32 Num : Counts)
+	{
+		for (int32 Trial = 0; Trial < 8; ++Trial)
+		{
+			// whole numbers, so the kernels see the same origin the reference does
+			const FVector Origin(FMath::RoundToFloat(Random.FRandRange(-10000.f, 10000.f)), FMath::RoundToFloat(Random.FRandRange(-10000.f, 10000.f)), 0.f);
+			const FVector2D Forward = FVector2D(Random.FRandRange(-1.f, 1.f), Random.FRandRange(-1.f, 1.f)).GetSafeNormal(SMALL_NUMBER, FVector2D(1.0, 0.0));
+
+			FAimAssistScoreWeights Weights;
+			Weights.WDist = Random.FRandRange(0.f, 2.f);
+			Weights.WAngle = Random.FRandRange(0.f, 2.f);
+			Weights.WVel = Random.FRandRange(0.f, 1.f);
+			Weights.WSticky = Random.FRandRange(0.f, 1.f);
+
+			TArray<FCandidate> Candidates;
+			MakeRandomCandidates(Random, Num, Origin, Candidates);
+
+			FAimAssistCandidateSoA Simd;
+			Simd.Reset(Num);
+			for (const FCandidate& Candidate : Candidates)
+			{
+				Simd.Add(Candidate.AimPoint, Candidate.Velocity, Candidate.bIsCurrent);
+			}
+			FAimAssistCandidateSoA Scalar = Simd;
+
+			const FVector2f Origin2f(Origin.X, Origin.Y);
+			const FVector2f Forward2f(Forward);
+			AimAssistScoring::ScoreCandidates(Simd, Origin2f, Forward2f, Weights);
+			AimAssistScoring::ScoreCandidatesScalar(Scalar, Origin2f, Forward2f, Weights);
+
+			if (!TestEqual(FString::Printf(TEXT("SIMD output size for %d candidates"), Num), Simd.Score.Num(), Num)
+				|| !TestEqual(FString::Printf(TEXT("Scalar output size for %d candidates"), Num), Scalar.Score.Num(), Num))
+			{
+				return false;
+			}
+
+			// both kernels are checked against the reference, so a shared helper can't hide a bug in either
+			for (int32 i = 0; i < Num; ++i)
+			{
+				const FExpected Expected = ScoreReference(Candidates[i], Origin, Forward, Weights);
+
+				for (const FAimAssistCandidateSoA* Kernel : { &Simd, &Scalar })
+				{
+					if (!Matches(Kernel->Dist2D[i], Expected.Dist2D) || !Matches(Kernel->Dot2D[i], Expected.Dot2D) || !Matches(Kernel->Score[i], Expected.Score))
+					{
+						AddError(FString::Printf(TEXT("%s candidate %d of %d (trial %d) differs from the reference: dist %f vs %f, dot %f vs %f, score %f vs %f"),
+							Kernel == &Simd ? TEXT("SIMD") : TEXT("Scalar"), i, Num, Trial,
+							Kernel->Dist2D[i], Expected.Dist2D, Kernel->Dot2D[i], Expected.Dot2D, Kernel->Score[i], Expected.Score));
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
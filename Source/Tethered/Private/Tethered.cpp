@@ -1,8 +1,25 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Tethered.h"
+#include "Interfaces/InterfaceDispatchCache.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Tethered, "Tethered" );
+/** Game module; owns the lifetime of the project's static caches */
+class FTetheredModule : public FDefaultGameModuleImpl
+{
+public:
+
+	virtual void StartupModule() override
+	{
+		FInterfaceDispatchCache::RegisterResetDelegates();
+	}
+
+	virtual void ShutdownModule() override
+	{
+		FInterfaceDispatchCache::UnregisterResetDelegates();
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FTetheredModule, Tethered, "Tethered" );
 
 TETHERED_API DEFINE_LOG_CATEGORY(LogTethered)
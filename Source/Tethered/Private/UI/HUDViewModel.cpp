@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UI/HUDViewModel.h"
+#include "Subsystems/HUDViewModelSubsystem.h"
+#include "UI/CombatLifeBar.h"
+#include "UI/SideScrollingUI.h"
+#include "Engine/World.h"
+
+FHUDViewModel::~FHUDViewModel()
+{
+	// don't leave a dangling entry in the flush queue
+	if (UHUDViewModelSubsystem* Subsystem = QueuedIn.Get())
+	{
+		Subsystem->Cancel(*this);
+	}
+}
+
+void FHUDViewModel::MarkDirty()
+{
+	const UUserWidget* BoundWidget = Widget.Get();
+	UWorld* World = BoundWidget ? BoundWidget->GetWorld() : nullptr;
+	if (!World)
+	{
+		return;
+	}
+
+	if (UHUDViewModelSubsystem* Subsystem = World->GetSubsystem<UHUDViewModelSubsystem>())
+	{
+		Subsystem->Enqueue(*this);
+	}
+	else
+	{
+		// no flush in this world type, push right away
+		Refresh();
+	}
+}
+
+void FHUDViewModel::BindWidget(UUserWidget* InWidget)
+{
+	Widget = InWidget;
+	bRefreshAll = true;
+	MarkDirty();
+}
+
+void FLifeBarViewModel::Bind(UCombatLifeBar* InWidget)
+{
+	BindWidget(InWidget);
+}
+
+void FLifeBarViewModel::SetLifePercentage(float InPercent)
+{
+	if (Percent != InPercent)
+	{
+		Percent = InPercent;
+		bPercentDirty = true;
+		MarkDirty();
+	}
+}
+
+void FLifeBarViewModel::SetBarColor(const FLinearColor& InColor)
+{
+	if (Color != InColor)
+	{
+		Color = InColor;
+		bColorDirty = true;
+		MarkDirty();
+	}
+}
+
+void FLifeBarViewModel::Refresh()
+{
+	UCombatLifeBar* LifeBar = Cast<UCombatLifeBar>(Widget.Get());
+	if (!LifeBar)
+	{
+		return;
+	}
+
+	if (bColorDirty || bRefreshAll)
+	{
+		LifeBar->SetBarColor(Color);
+	}
+
+	if (bPercentDirty || bRefreshAll)
+	{
+		LifeBar->SetLifePercentage(Percent);
+	}
+
+	bColorDirty = bPercentDirty = bRefreshAll = false;
+}
+
+void FPickupCounterViewModel::Bind(USideScrollingUI* InWidget)
+{
+	BindWidget(InWidget);
+}
+
+void FPickupCounterViewModel::SetPickups(int32 InPickups)
+{
+	if (Pickups != InPickups)
+	{
+		Pickups = InPickups;
+		MarkDirty();
+	}
+}
+
+void FPickupCounterViewModel::Refresh()
+{
+	if (USideScrollingUI* UI = Cast<USideScrollingUI>(Widget.Get()))
+	{
+		UI->UpdatePickups(Pickups);
+	}
+
+	bRefreshAll = false;
+}
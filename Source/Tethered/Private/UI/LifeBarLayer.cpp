@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "UI/LifeBarLayer.h"
+#include "Subsystems/LifeBarSubsystem.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+
+void SLifeBarLayer::Construct(const FArguments& InArgs)
+{
+	Subsystem = InArgs._Subsystem;
+	Brush = FCoreStyle::Get().GetBrush("GenericWhiteBox");
+
+	// purely visual, never takes input
+	SetVisibility(EVisibility::HitTestInvisible);
+}
+
+int32 SLifeBarLayer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements,
+	int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	const ULifeBarSubsystem* LifeBars = Subsystem.Get();
+	if (!LifeBars || LifeBars->GetProjectedBars().IsEmpty())
+	{
+		return LayerId;
+	}
+
+	// bars are projected in viewport pixels; the layer covers the viewport in DPI scaled units
+	const float InvScale = 1.0f / AllottedGeometry.Scale;
+	const FVector2f Size = LifeBars->BarSize;
+	const FVector2f HalfSize = Size * 0.5f;
+	const FLinearColor BackgroundColor = LifeBars->BackgroundColor * InWidgetStyle.GetColorAndOpacityTint();
+
+	// every background first, on one layer with one brush
+	for (const FProjectedLifeBar& Bar : LifeBars->GetProjectedBars())
+	{
+		const FVector2f TopLeft = Bar.ScreenPosition * InvScale - HalfSize;
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(Size, FSlateLayoutTransform(TopLeft)),
+			Brush, ESlateDrawEffect::None, BackgroundColor);
+	}
+
+	// then every fill on the layer above
+	const int32 FillLayerId = LayerId + 1;
+	for (const FProjectedLifeBar& Bar : LifeBars->GetProjectedBars())
+	{
+		if (Bar.Percent <= 0.0f)
+		{
+			continue;
+		}
+
+		const FVector2f TopLeft = Bar.ScreenPosition * InvScale - HalfSize;
+		FSlateDrawElement::MakeBox(OutDrawElements, FillLayerId, AllottedGeometry.ToPaintGeometry(FVector2f(Size.X * Bar.Percent, Size.Y), FSlateLayoutTransform(TopLeft)),
+			Brush, ESlateDrawEffect::None, Bar.Color * InWidgetStyle.GetColorAndOpacityTint());
+	}
+
+	return FillLayerId;
+}
+
+FVector2D SLifeBarLayer::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	// fills whatever slot it's given
+	return FVector2D::ZeroVector;
+}
@@ -9,11 +9,17 @@
 #include "Interfaces/Aimable.h"
 #include "Animation/AnimMontage.h"
 #include "Engine/TimerHandle.h"
+#include "Components/MeleeSwingTrace.h"
+#include "Components/CombatBakedAttack.h"
+#include "Engine/StreamableManager.h"
 #include "CombatEnemy.generated.h"
 
 class UWidgetComponent;
+class UCapsuleComponent;
 class UCombatLifeBar;
 class UAnimMontage;
+class UCombatMontageBake;
+class ACombatEnemy;
 
 /** Completed attack animation delegate for StateTree */
 DECLARE_DELEGATE(FOnEnemyAttackCompleted);
@@ -24,6 +30,9 @@ DECLARE_DELEGATE(FOnEnemyLanded);
 /** Enemy died delegate */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnEnemyDied);
 
+/** Enemy released delegate, for handing a dead enemy back to its pool */
+DECLARE_DELEGATE_OneParam(FOnEnemyReleased, ACombatEnemy*);
+
 /**
  *  An AI-controlled character with combat capabilities.
  *  Its bundled AI Controller runs logic through StateTree
@@ -33,9 +42,9 @@ class ACombatEnemy : public ACharacter, public ICombatAttacker, public ICombatDa
 {
 	GENERATED_BODY()
 
-	/** Life bar widget component */
+	/** Query only hurtbox found by player attacks */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Components", meta = (AllowPrivateAccess = "true"))
-	UWidgetComponent* LifeBar;
+	UCapsuleComponent* Hurtbox;
 
 public:
 	
@@ -60,9 +69,24 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Damage")
 	FName PelvisBoneName;
 
-	/** Pointer to the life bar widget */
-	UPROPERTY(EditAnywhere, Category="Damage")
-	UCombatLifeBar* LifeBarWidget;
+	/** Offset from the actor root where the screen space life bar is drawn */
+	UPROPERTY(EditAnywhere, Category="Life Bar")
+	FVector LifeBarOffset = FVector(0.0f, 0.0f, 120.0f);
+
+	/** Fill color of the life bar */
+	UPROPERTY(EditAnywhere, Category="Life Bar")
+	FLinearColor LifeBarColor = FLinearColor::Red;
+
+	/** Handle of our bar in the life bar subsystem */
+	int32 LifeBarHandle = INDEX_NONE;
+
+	/** Deprecated: enemy life bars are drawn by ULifeBarSubsystem. Kept so Blueprints saved with the widget component still load */
+	UPROPERTY()
+	UWidgetComponent* LifeBar_DEPRECATED;
+
+	/** Deprecated: enemy life bars are drawn by ULifeBarSubsystem. Kept so Blueprints saved with the widget still load */
+	UPROPERTY()
+	UCombatLifeBar* LifeBarWidget_DEPRECATED;
 
 	/** If true, the character is currently playing an attack animation */
 	bool bIsAttacking = false;
@@ -89,7 +113,11 @@ protected:
 
 	/** AnimMontage that will play for combo attacks */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Combo")
-	UAnimMontage* ComboAttackMontage;
+	TSoftObjectPtr<UAnimMontage> ComboAttackMontage;
+
+	/** Baked form of the combo attack montage, used on dedicated servers and while the enemy isn't rendered */
+	UPROPERTY(EditAnywhere, Category="Melee Attack|Combo")
+	UCombatMontageBake* ComboAttackBake;
 
 	/** Names of the AnimMontage sections that correspond to each stage of the combo attack */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Combo")
@@ -103,7 +131,11 @@ protected:
 
 	/** AnimMontage that will play for charged attacks */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Charged")
-	UAnimMontage* ChargedAttackMontage;
+	TSoftObjectPtr<UAnimMontage> ChargedAttackMontage;
+
+	/** Baked form of the charged attack montage, used on dedicated servers and while the enemy isn't rendered */
+	UPROPERTY(EditAnywhere, Category="Melee Attack|Charged")
+	UCombatMontageBake* ChargedAttackBake;
 
 	/** Name of the AnimMontage section that corresponds to the charge loop */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Charged")
@@ -137,6 +169,18 @@ protected:
 	/** Attack montage ended delegate */
 	FOnMontageEnded OnAttackMontageEnded;
 
+	/** Continuous sweep for the open attack swing window */
+	FMeleeSwingTrace SwingTrace;
+
+	/** Reused list of new hits from the swing sweep */
+	TArray<FHitResult> SwingHits;
+
+	/** Animation-free attack playback, when running from bakes */
+	FCombatBakedAttack BakedAttack;
+
+	/** Keeps the attack montages loaded */
+	TSharedPtr<FStreamableHandle> MontageLoadHandle;
+
 public:
 	/** Attack completed internal delegate to notify StateTree tasks */
 	FOnEnemyAttackCompleted OnAttackCompleted;
@@ -148,6 +192,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Events")
 	FOnEnemyDied OnEnemyDied;
 
+	/** Called instead of destroying the enemy once its death time is up, when bound by a pool */
+	FOnEnemyReleased OnEnemyReleased;
+
 public:
 
 	/** Performs an AI-initiated combo attack. Number of hits will be decided by this character */
@@ -159,6 +206,23 @@ public:
 	/** Called from a delegate when the attack montage ends */
 	void AttackMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 
+protected:
+
+	/** Applies damage and knockback for a single melee hit if it landed on the player */
+	void ApplyMeleeHit(const FHitResult& Hit);
+
+	/** Returns true if attacks should run from bakes instead of animation */
+	bool ShouldUseBakedAttacks() const;
+
+	/** Plays an attack from its bake or its montage */
+	void PlayAttack(const TSoftObjectPtr<UAnimMontage>& MontagePtr, UCombatMontageBake* Bake);
+
+	/** Jumps the playing attack to the given section */
+	void JumpToAttackSection(FName SectionName, UAnimMontage* Montage);
+
+	/** Gets the world position of a damage source bone, from the bake when one is playing */
+	FVector GetDamageSourceLocation(FName DamageSourceBone) const;
+
 public:
 
 	// ~begin ICombatAttacker interface
@@ -166,6 +230,15 @@ public:
 	/** Performs an attack's collision check */
 	virtual void DoAttackTrace(FName DamageSourceBone) override;
 
+	/** Opens an attack swing window following the given bone */
+	virtual void BeginAttackSwing(FName DamageSourceBone) override;
+
+	/** Sweeps the open attack swing since the last frame */
+	virtual void TickAttackSwing() override;
+
+	/** Closes the attack swing window */
+	virtual void EndAttackSwing() override;
+
 	/** Performs a combo attack's check to continue the string */
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckCombo() override;
@@ -194,6 +267,23 @@ protected:
 	/** Removes this character from the level after it dies */
 	void RemoveFromLevel();
 
+	/** Stops any attack in progress and closes its swing window */
+	void ResetAttackState();
+
+	/** Adds our life bar and registers with aim assist and the hurtbox registry */
+	void RegisterCombatPresence();
+
+	/** Removes our life bar and leaves aim assist and the hurtbox registry */
+	void UnregisterCombatPresence();
+
+public:
+
+	/** Brings a pooled enemy back to life at full HP at the given transform, and restarts its StateTree */
+	void ResetForSpawn(const FTransform& SpawnTransform);
+
+	/** Puts the enemy to sleep until its next spawn: hidden, without collision, ticking or AI logic */
+	void DeactivateForPool();
+
 public:
 
 	/** Overrides the default TakeDamage functionality */
@@ -213,6 +303,9 @@ protected:
 	/** Gameplay initialization */
 	virtual void BeginPlay() override;
 
+	/** Advances baked attacks */
+	virtual void Tick(float DeltaSeconds) override;
+
 	/** EndPlay cleanup */
 	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Interfaces/CombatActivatable.h"
+#include "Engine/StreamableManager.h"
 #include "CombatEnemySpawner.generated.h"
 
 class UCapsuleComponent;
@@ -16,6 +17,8 @@ class ACombatEnemy;
  *  Enemies will be spawned one by one, and the spawner will wait until the enemy dies before spawning a new one.
  *  The spawner can be remotely activated through the ICombatActivatable interface
  *  When the last spawned enemy dies, the spawner can also activate other ICombatActivatables
+ *  Enemies are pooled: a few are created hidden as soon as the enemy class loads, and dead enemies are reset
+ *  and reused for the next spawn instead of being destroyed and spawned again
  */
 UCLASS(abstract)
 class ACombatEnemySpawner : public AActor, public ICombatActivatable
@@ -30,9 +33,9 @@ class ACombatEnemySpawner : public AActor, public ICombatActivatable
 
 protected:
 
-	/** Type of enemy to spawn */
+	/** Type of enemy to spawn. Loaded on demand so maps don't pull in every enemy up front */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner")
-	TSubclassOf<ACombatEnemy> EnemyClass;
+	TSoftClassPtr<ACombatEnemy> EnemyClass;
 
 	/** If true, the first enemy will be spawned as soon as the game starts */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner")
@@ -50,6 +53,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner", meta = (ClampMin = 0, ClampMax = 10))
 	float RespawnDelay = 5.0f;
 
+	/** Number of enemies created ahead of time and recycled between respawns. Never more than SpawnCount */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Enemy Spawner", meta = (ClampMin = 0, ClampMax = 10))
+	int32 PoolSize = 2;
+
 	/** Time to wait after this spawner is depleted before activating the actor list */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Activation", meta = (ClampMin = 0, ClampMax = 10))
 	float ActivationDelay = 1.0f;
@@ -64,6 +71,16 @@ protected:
 	/** Timer to spawn enemies after a delay */
 	FTimerHandle SpawnTimer;
 
+	/** Keeps the enemy class loaded once prefetched */
+	TSharedPtr<FStreamableHandle> EnemyClassHandle;
+
+	/** Dormant enemies waiting to be spawned */
+	UPROPERTY(Transient)
+	TArray<ACombatEnemy*> EnemyPool;
+
+	/** Number of enemies created ahead of time so far */
+	int32 NumPreWarmed = 0;
+
 public:	
 	
 	/** Constructor */
@@ -77,10 +94,16 @@ public:
 	/** Cleanup */
 	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
 
+	/** Spawns an enemy right away. Called by the spawn scheduler once our request comes up */
+	void SpawnEnemy();
+
+	/** Creates one dormant enemy for the pool. Returns true if the pool still wants more */
+	bool WarmPoolStep();
+
 protected:
 
-	/** Spawn an enemy and subscribe to its death event */
-	void SpawnEnemy();
+	/** Queues a spawn with the spawn scheduler, or spawns right away if there's none */
+	void QueueSpawn();
 
 	/** Called when the spawned enemy has died */
 	UFUNCTION()
@@ -89,6 +112,21 @@ protected:
 	/** Called after the last spawned enemy has died */
 	void SpawnerDepleted();
 
+	/** Starts loading the enemy class in the background, and fills the pool once it's loaded */
+	void PrefetchEnemyClass();
+
+	/** Queues the pool warm-up with the spawn scheduler, or fills the pool right away if there's none */
+	void WarmPool();
+
+	/** Creates a new enemy bound to this spawner's pool */
+	ACombatEnemy* CreatePooledEnemy(UClass* LoadedEnemyClass);
+
+	/** Destroys every dormant enemy */
+	void DestroyPool();
+
+	/** Takes back a dead enemy once its death time is up */
+	void ReturnEnemyToPool(ACombatEnemy* Enemy);
+
 public:
 
 	// ~begin ICombatActivatable interface
@@ -105,5 +143,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Activatable")
 	virtual void DeactivateInteraction(AActor* ActivationInstigator) override;
 
+	/** Prefetches the enemy class ahead of activation */
+	virtual void PrefetchInteraction(AActor* ActivationInstigator) override;
+
 	// ~end IActivatable interface
 };
@@ -285,13 +285,17 @@ struct FStateTreeGetPlayerInfoInstanceData
 	UPROPERTY(VisibleAnywhere)
 	FVector TargetPlayerLocation = FVector::ZeroVector;
 
+	/** Last known velocity for the target */
+	UPROPERTY(VisibleAnywhere)
+	FVector TargetPlayerVelocity = FVector::ZeroVector;
+
 	/** Distance to the target */
 	UPROPERTY(VisibleAnywhere)
 	float DistanceToTarget = 0.0f;
 };
 
 /**
- *  StateTree task to get information about the player character
+ *  StateTree task to get information about the player character nearest to the owner
  */
 USTRUCT(meta=(DisplayName="GetPlayerInfo", Category="Combat"))
 struct FStateTreeGetPlayerInfoTask : public FStateTreeTaskCommonBase
@@ -47,6 +47,9 @@ public:
 
 public:
 
+	/** Initialization */
+	virtual void BeginPlay() override;
+
 	/** Cleanup */
 	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
 
@@ -39,7 +39,7 @@ struct FStateTreeGetPlayerInstanceData
 };
 
 /**
- *  StateTree task to get the player-controlled character
+ *  StateTree task to get the player-controlled character nearest to the NPC
  */
 USTRUCT(meta=(DisplayName="Get Player", Category="Side Scrolling"))
 struct FStateTreeGetPlayerTask : public FStateTreeTaskCommonBase
@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "AnimNotifyState_AttackSwing.generated.h"
+
+/**
+ *  AnimNotifyState that opens an attack swing window on the actor.
+ *  The attack bone is swept continuously from frame to frame while the window is open,
+ *  and each target is damaged at most once per window.
+ */
+UCLASS()
+class UAnimNotifyState_AttackSwing : public UAnimNotifyState
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Source bone or socket for the attack sweep */
+	UPROPERTY(EditAnywhere, Category="Attack")
+	FName AttackBoneName;
+
+public:
+
+	/** Open the swing window */
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+
+	/** Sweep the swing since the last frame */
+	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
+
+	/** Close the swing window */
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+	/** Get the notify name */
+	virtual FString GetNotifyName_Implementation() const override;
+
+	/** Get the attack source bone */
+	FName GetAttackBoneName() const { return AttackBoneName; }
+};
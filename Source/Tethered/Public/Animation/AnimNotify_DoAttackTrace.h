@@ -27,4 +27,7 @@ public:
 
 	/** Get the notify name */
 	virtual FString GetNotifyName_Implementation() const override;
+
+	/** Get the attack source bone */
+	FName GetAttackBoneName() const { return AttackBoneName; }
 };
@@ -20,6 +20,7 @@ class UInputAction;
 struct FInputActionValue;
 class UCombatLifeBar;
 class UWidgetComponent;
+class UCapsuleComponent;
 class UCombatComponent;
 class UHealthComponent;
 class UPlayerMovementComponent;
@@ -66,6 +67,10 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
 	UAimAssistComponent* AimAssistComponent;
 
+	/** Query only hurtbox found by enemy attacks */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
+	UCapsuleComponent* Hurtbox;
+
 #pragma endregion Components
 
 #pragma region Input Actions
@@ -270,6 +275,15 @@ public:
 	/** Performs the collision check for an attack - delegates to CombatComponent */
 	virtual void DoAttackTrace(FName DamageSourceBone) override;
 
+	/** Opens an attack swing window - delegates to CombatComponent */
+	virtual void BeginAttackSwing(FName DamageSourceBone) override;
+
+	/** Sweeps the open attack swing - delegates to CombatComponent */
+	virtual void TickAttackSwing() override;
+
+	/** Closes the attack swing window - delegates to CombatComponent */
+	virtual void EndAttackSwing() override;
+
 	/** Performs the combo string check - delegates to CombatComponent */
 	virtual void CheckCombo() override;
 
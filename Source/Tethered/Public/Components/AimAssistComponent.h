@@ -3,11 +3,17 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Data/AimAssistProfile.h"
+#include "Subsystems/AimableRegistrySubsystem.h"
+#include "Components/AimAssistScoring.h"
+#include "Components/AimAssistSelection.h"
+#include "Components/AimAssistRecorder.h"
 #include "AimAssistComponent.generated.h"
 
 class APlayerController;
 class ACharacter;
 class UProjectileMovementComponent;
+class UDebugDrawSubsystem;
+class UAimAssistSolverSubsystem;
 
 UCLASS(ClassGroup = (Combat), meta = (BlueprintSpawnableComponent))
 class TETHERED_API UAimAssistComponent : public UActorComponent
@@ -32,6 +38,16 @@ public:
 	/** Returns the currently targeted actor, if any */
 	UFUNCTION(BlueprintPure) AActor* GetCurrentTarget() const { return CurrentTarget.Get(); }
 
+	// Decision capture
+	/** Starts recording every query into the capture ring */
+	UFUNCTION(BlueprintCallable, Category = "Debug") void StartDecisionRecording();
+	
+	/** Stops recording and writes the capture to Saved/AimAssist. Returns the file path, or an empty string on failure */
+	UFUNCTION(BlueprintCallable, Category = "Debug") FString StopDecisionRecording();
+	
+	/** Returns true while queries are being recorded */
+	UFUNCTION(BlueprintPure, Category = "Debug") bool IsRecordingDecisions() const { return Recorder.IsRecording(); }
+
 	/** Global debug state for aim assist visualization - accessible to console commands */
 	static bool bGlobalDebugEnabled;
 
@@ -41,18 +57,31 @@ protected:
 	void TickComponent(float DeltaTime, ELevelTick, FActorComponentTickFunction*) override;
 
 private:
+	// The solver gathers candidates once per frame and runs every due player's query against them
+	friend class UAimAssistSolverSubsystem;
+
 	// Query
-	/** Searches for potential targets within range and selects the best one */
-	void QueryForTarget();
-	
-	/** Checks if target is within the field of view cone */
-	bool PassesFOV2D(const FVector& ToTarget2D) const;
-	
-	/** Performs line of sight check to target's aim point */
-	bool HasLineOfSightToAimPoint(AActor* Target) const;
+	/** Launches the range, score, FOV, targetability and top-K stages as a task against the solver's shared snapshot */
+	void QueryForTarget(UAimAssistSolverSubsystem& Solver);
+
+	/** Takes a published selection result and queues LOS checks for its survivors */
+	void ConsumeSelection();
+
+	/** Reports the origin and radius this player needs candidates from. Returns false if the component can't query yet */
+	bool GetQueryBounds(FVector& OutOrigin, float& OutRange) const;
+
+	/** Decides whether a query is due this frame based on player motion, target state and candidate movement */
+	bool ShouldQuery(float Dt);
+
+	/** Updates the rolling effective query rate */
+	void UpdateQueryRate(float Dt);
+
+	/** Receives a single shared line of sight result for the pending batch issued by the query with the given serial */
+	void OnSharedLineOfSight(int32 RequestIndex, uint32 InQuerySerial, bool bHasLOS);
+
+	/** Selects the best candidate with line of sight once the whole batch has resolved */
+	void ResolveTargetFromLineOfSight();
 	
-	/** Calculates a score for target prioritization based on distance, angle, and velocity */
-	float ScoreTarget(AActor* Target, float Dist2D, float Dot2D, bool bIsCurrent) const;
 
 	// Assist
 	/** Applies various forms of aim assistance each frame */
@@ -69,19 +98,19 @@ private:
 	void DrawDebugInfo();
 	
 	/** Draws the detection range sphere */
-	void DrawDetectionRange();
+	void DrawDetectionRange(UDebugDrawSubsystem& DebugDraw);
 	
 	/** Draws the FOV cone */
-	void DrawFOVCone();
+	void DrawFOVCone(UDebugDrawSubsystem& DebugDraw);
 	
 	/** Draws assist cones (friction, snap) */
-	void DrawAssistCones();
+	void DrawAssistCones(UDebugDrawSubsystem& DebugDraw);
 	
 	/** Draws line of sight traces to targets */
-	void DrawLineOfSightTraces();
+	void DrawLineOfSightTraces(UDebugDrawSubsystem& DebugDraw);
 	
 	/** Draws target information and scores */
-	void DrawTargetInfo();
+	void DrawTargetInfo(UDebugDrawSubsystem& DebugDraw);
 
 	// Helpers
 	/** Calculates 2D angle between two normalized vectors in degrees */
@@ -103,26 +132,79 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Profiles")
 	TObjectPtr<UAimAssistProfile> Profile;
 
-	// Overlap by object types (Pawn by default)
-	UPROPERTY(EditAnywhere, Category = "Query") TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes =
-	{ UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_Pawn) };
-
 	UPROPERTY(EditAnywhere, Category = "Query") TEnumAsByte<ECollisionChannel> LOSChannel = ECC_Visibility;
 	UPROPERTY(EditAnywhere, Category = "Query") float QueryInterval = 0.07f;
 
-	FTimerHandle QueryTimer;
+	/** Slow cadence used while neither the player nor anything in range is moving */
+	UPROPERTY(EditAnywhere, Category = "Query", meta = (ClampMin = 0.0))
+	float IdleQueryInterval = 0.3f;
+
+	/** Yaw change since the last query that forces an immediate re-query */
+	UPROPERTY(EditAnywhere, Category = "Query", meta = (ClampMin = 0.0, Units = "Degrees"))
+	float RequeryYawThresholdDeg = 20.f;
+
+	/** Player displacement since the last query that forces an immediate re-query */
+	UPROPERTY(EditAnywhere, Category = "Query", meta = (ClampMin = 0.0, Units = "Centimeters"))
+	float RequeryDistanceThresholdCm = 100.f;
+
+	/** Speed below which the player and candidates count as stationary for the idle cadence */
+	UPROPERTY(EditAnywhere, Category = "Query", meta = (ClampMin = 0.0))
+	float IdleSpeedThreshold = 10.f;
+
+	/** Only this many of the best-scoring candidates get a LOS trace each query (the current target is always traced) */
+	UPROPERTY(EditAnywhere, Category = "Query", meta = (ClampMin = 1, ClampMax = 16))
+	int32 MaxLineOfSightCandidates = 3;
+
+	// Query scheduling state
+	float TimeSinceQuery = 0.f;
+	FVector LastQueryLocation = FVector::ZeroVector;
+	float LastQueryYaw = 0.f;
+	bool bForceQuery = true;
+	bool bCandidatesMoving = false;
+
+	// Rolling effective query rate
+	int32 QueriesInWindow = 0;
+	float QueryRateWindow = 0.f;
+	float EffectiveQueryRate = 0.f;
+
+	/** A candidate waiting on its line of sight result */
+	struct FPendingLineOfSight
+	{
+		TWeakObjectPtr<AActor> Target;
+		float Score = 0.f;
+		int32 RecordSlot = INDEX_NONE;
+		bool bWaiting = false;
+		bool bHasLOS = false;
+	};
+
+	// Selection task launched by the last query, consumed from tick once it has published
+	TSharedPtr<FAimAssistSelectionJob, ESPMode::ThreadSafe> PendingSelection;
+
+	// LOS batch issued by the last query; resolved once the solver has reported every result
+	TArray<FPendingLineOfSight> PendingLineOfSight;
+	int32 PendingLineOfSightCount = 0;
+	uint32 QuerySerial = 0;
 
 	UPROPERTY() TWeakObjectPtr<AActor> CurrentTarget;
 	float     AimInputMagnitude = 0.f;
 
 	// Score weights
-	float WDist = 0.6f, WAngle = 1.0f, WVel = 0.2f, WSticky = 0.5f;
+	FAimAssistScoreWeights ScoreWeights;
+
+	/** Start recording query decisions on BeginPlay, for offline replay with the AimAssistReplay commandlet */
+	UPROPERTY(EditAnywhere, Category = "Debug") bool bRecordDecisions = false;
+
+	/** Number of most recent queries kept in the capture ring */
+	UPROPERTY(EditAnywhere, Category = "Debug", meta = (ClampMin = 1)) int32 DecisionRecordCapacity = 8192;
+
+	FAimAssistRecorder Recorder;
 
 	// Cached
 	UPROPERTY() TWeakObjectPtr<ACharacter> OwnerChar;
 	UPROPERTY() TWeakObjectPtr<APlayerController> PC;
-	
+
 	// Cache potential targets for debug display
 	TArray<AActor*> DebugPotentialTargets;
 	TArray<float> DebugTargetScores;
+	TArray<bool> DebugTargetHasLOS;
 };
@@ -0,0 +1,137 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/AimAssistScoring.h"
+
+/** Furthest pipeline stage a recorded candidate reached */
+enum class EAimAssistRecordedStage : uint8
+{
+	RejectedRange,
+	RejectedFOV,
+	RejectedTargetable,
+	RejectedTopK,
+	RejectedLOS,
+	Selectable
+};
+
+/** A single candidate as seen by one aim assist query */
+struct FAimAssistRecordedCandidate
+{
+	/** Capture-unique id of the candidate actor */
+	uint32 ActorId = 0;
+
+	/** 2D aim point and velocity fed to the scoring kernel */
+	FVector2f Position = FVector2f::ZeroVector;
+	FVector2f Velocity = FVector2f::ZeroVector;
+
+	/** Score computed by the live query */
+	float Score = 0.f;
+
+	/** Furthest stage this candidate reached */
+	EAimAssistRecordedStage Stage = EAimAssistRecordedStage::Selectable;
+
+	friend FArchive& operator<<(FArchive& Ar, FAimAssistRecordedCandidate& Candidate);
+};
+
+/** Everything one aim assist query saw and decided */
+struct FAimAssistRecordedQuery
+{
+	/** World time the query ran */
+	double Time = 0.0;
+
+	/** Query origin and facing in 2D */
+	FVector2f Origin = FVector2f::ZeroVector;
+	FVector2f Forward = FVector2f::ZeroVector;
+
+	/** Profile parameters active for this query */
+	float MinFOVCos = 0.f;
+	float Stickiness = 0.f;
+	int32 MaxLineOfSightCandidates = 0;
+
+	/** Target before and after the query, 0 for none */
+	uint32 PreviousTargetId = 0;
+	uint32 ChosenTargetId = 0;
+
+	/** Time spent in target selection, before line of sight */
+	float QueryMs = 0.f;
+
+	/** Candidates in range, in registry order */
+	TArray<FAimAssistRecordedCandidate> Candidates;
+
+	friend FArchive& operator<<(FArchive& Ar, FAimAssistRecordedQuery& Query);
+};
+
+/** Contents of a capture file */
+struct FAimAssistCapture
+{
+	/** Score weights used during the session */
+	FAimAssistScoreWeights Weights;
+
+	/** Recorded queries, oldest first */
+	TArray<FAimAssistRecordedQuery> Queries;
+};
+
+/**
+ *  Records aim assist queries into a fixed-size ring so long sessions keep only the most recent history.
+ *  A query is opened when QueryForTarget runs and committed once its LOS batch resolves;
+ *  queries superseded before resolving are dropped.
+ */
+class TETHERED_API FAimAssistRecorder
+{
+public:
+
+	/** Starts recording into a ring of the given size, clearing any previous capture */
+	void Start(int32 InCapacity, const FAimAssistScoreWeights& InWeights);
+
+	/** Stops recording. The captured queries are kept until the next Start */
+	void Stop();
+
+	/** Returns true while recording */
+	bool IsRecording() const { return bRecording; }
+
+	/** Opens a new query record, discarding any query that never resolved */
+	FAimAssistRecordedQuery& BeginQuery();
+
+	/** Returns the open query, or nullptr */
+	FAimAssistRecordedQuery* GetOpenQuery() { return bQueryOpen ? &OpenQuery : nullptr; }
+
+	/** Commits the open query into the ring */
+	void CommitQuery();
+
+	/** Writes the ring to a binary capture file, oldest query first */
+	bool SaveToFile(const FString& Filename) const;
+
+	/** Reads a capture file written by SaveToFile */
+	static bool LoadFromFile(const FString& Filename, FAimAssistCapture& OutCapture);
+
+	/**
+	 *  Returns the actor's id in this capture, 0 for none. Ids are handed out in first-seen order and never reused,
+	 *  so an enemy spawned into a destroyed one's object slot still gets an id of its own
+	 */
+	uint32 GetActorId(const AActor* Actor);
+
+private:
+
+	/** Capture file identification */
+	static constexpr uint32 FileMagic = 0x52414154; // 'TAAR'
+	static constexpr uint32 FileVersion = 1;
+
+	bool bRecording = false;
+	bool bQueryOpen = false;
+
+	FAimAssistScoreWeights Weights;
+	FAimAssistRecordedQuery OpenQuery;
+
+	/** Ring storage; Head is the slot the next committed query goes into */
+	TArray<FAimAssistRecordedQuery> Ring;
+	int32 Capacity = 0;
+	int32 Head = 0;
+
+	/** Ids handed out this capture. Weak keys stop matching once their actor is gone, even if its slot is reused */
+	TMap<TWeakObjectPtr<const AActor>, uint32> ActorIds;
+
+	/** Next id to hand out; only ever increases within a capture */
+	uint32 NextActorId = 1;
+};
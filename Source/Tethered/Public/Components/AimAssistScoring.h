@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Weights for each term of the aim assist candidate score */
+struct FAimAssistScoreWeights
+{
+	/** Weight of the inverse 2D distance term */
+	float WDist = 0.6f;
+
+	/** Weight of the facing (dot product) term */
+	float WAngle = 1.0f;
+
+	/** Weight of the target velocity alignment term */
+	float WVel = 0.2f;
+
+	/** Bonus weight for the current target */
+	float WSticky = 0.5f;
+};
+
+/**
+ *  Structure-of-arrays buffer of aim assist candidates.
+ *  Inputs are gathered once per query, and the scoring kernel fills the outputs for all candidates in one pass.
+ */
+struct TETHERED_API FAimAssistCandidateSoA
+{
+	// Inputs
+	TArray<float> PosX;
+	TArray<float> PosY;
+	TArray<float> VelX;
+	TArray<float> VelY;
+	TArray<float> Sticky;
+
+	// Outputs
+	TArray<float> Dist2D;
+	TArray<float> Dot2D;
+	TArray<float> Score;
+
+	/** Empties the buffer while keeping its allocations */
+	void Reset(int32 ExpectedNum = 0);
+
+	/** Appends a candidate */
+	void Add(const FVector& AimPoint, const FVector& Velocity, bool bIsCurrent);
+
+	/** Number of candidates in the buffer */
+	int32 Num() const { return PosX.Num(); }
+};
+
+namespace AimAssistScoring
+{
+	/** Fills Dist2D, Dot2D and Score for every candidate using SIMD registers, four candidates at a time */
+	TETHERED_API void ScoreCandidates(FAimAssistCandidateSoA& Candidates, const FVector2f& Origin, const FVector2f& Forward, const FAimAssistScoreWeights& Weights);
+
+	/** Reference implementation of ScoreCandidates that scores one candidate at a time */
+	TETHERED_API void ScoreCandidatesScalar(FAimAssistCandidateSoA& Candidates, const FVector2f& Origin, const FVector2f& Forward, const FAimAssistScoreWeights& Weights);
+
+	/** Hysteresis: factor a challenger's score must exceed the current target's by, for the given stickiness */
+	TETHERED_API float GetHysteresisMultiplier(float Stickiness);
+
+	/** Hysteresis: returns true if the current target should be kept over a better scoring challenger */
+	TETHERED_API bool ShouldKeepCurrentTarget(float BestScore, float CurrentScore, float Stickiness);
+}
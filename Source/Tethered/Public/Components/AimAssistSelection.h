@@ -0,0 +1,108 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/AimAssistScoring.h"
+#include "Components/AimAssistRecorder.h"
+#include <atomic>
+
+/**
+ *  Read-only copy of the frame's aim assist candidates, built once on the game thread and shared by every
+ *  selection job launched that frame. Jobs only read the plain data; actor pointers are kept as identity keys
+ *  and are never dereferenced off the game thread.
+ */
+struct TETHERED_API FAimAssistSnapshot
+{
+	/** Game time the snapshot was taken */
+	double Time = 0.0;
+
+	/** Candidate actors, for mapping job results back on the game thread */
+	TArray<TWeakObjectPtr<AActor>> Actors;
+
+	/** Candidate identity keys, safe to compare off the game thread */
+	TArray<const AActor*> ActorKeys;
+
+	/** Candidate aim points */
+	TArray<FVector> AimPoints;
+
+	/** Scoring kernel inputs. The sticky flags are left at zero and set per player by the job */
+	FAimAssistCandidateSoA Inputs;
+
+	/** Whether each candidate allowed itself to be targeted when the snapshot was taken */
+	TArray<bool> Targetable;
+
+	/** Number of candidates in the snapshot */
+	int32 Num() const { return ActorKeys.Num(); }
+};
+
+/** Per-player inputs to a selection job, captured on the game thread */
+struct FAimAssistSelectionParams
+{
+	FVector2f Origin = FVector2f::ZeroVector;
+	FVector2f Forward = FVector2f(1.f, 0.f);
+	float RangeCm = 0.f;
+	float MinFOVCos = 0.f;
+	float IdleSpeedSq = 0.f;
+	int32 MaxLineOfSightCandidates = 3;
+	FAimAssistScoreWeights Weights;
+
+	/** Identity keys only, never dereferenced by the job */
+	const AActor* Owner = nullptr;
+	const AActor* CurrentTarget = nullptr;
+};
+
+/** A candidate within range of the player and the stage it reached before line of sight */
+struct FAimAssistSelectedCandidate
+{
+	int32 SnapshotIndex = INDEX_NONE;
+	float Score = 0.f;
+	EAimAssistRecordedStage Stage = EAimAssistRecordedStage::Selectable;
+};
+
+/** Output of a selection job */
+struct FAimAssistSelectionResult
+{
+	/** Every in-range candidate, in snapshot order */
+	TArray<FAimAssistSelectedCandidate> InRange;
+
+	/** Indices into InRange that need a line of sight check, best score first */
+	TArray<int32> LineOfSight;
+
+	/** True if anything in range is moving, for the query scheduler */
+	bool bCandidatesMoving = false;
+
+	/** Time the job spent selecting */
+	float SelectMs = 0.f;
+};
+
+/**
+ *  One player's target selection, run as a task off the game thread.
+ *  The game thread fills the snapshot and params, launches the job and polls IsPublished on later ticks.
+ *  The result must not be read before IsPublished returns true, and the job never touches it afterwards.
+ */
+struct TETHERED_API FAimAssistSelectionJob
+{
+	FAimAssistSelectionJob(const TSharedRef<const FAimAssistSnapshot, ESPMode::ThreadSafe>& InSnapshot, const FAimAssistSelectionParams& InParams)
+		: Snapshot(InSnapshot)
+		, Params(InParams)
+	{
+	}
+
+	/** Runs the range, score, FOV, targetability and top-K stages, then publishes the result */
+	void Run();
+
+	/** Returns true once the result is safe to read from the game thread */
+	bool IsPublished() const { return bPublished.load(std::memory_order_acquire); }
+
+	const TSharedRef<const FAimAssistSnapshot, ESPMode::ThreadSafe> Snapshot;
+	const FAimAssistSelectionParams Params;
+	FAimAssistSelectionResult Result;
+
+private:
+
+	/** Scoring kernel buffer owned by this job */
+	FAimAssistCandidateSoA Scoring;
+
+	std::atomic<bool> bPublished { false };
+};
@@ -0,0 +1,29 @@
+// AimAssistStats.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// Aim assist stats, shared by the component and the world solver - use 'stat AimAssist' to see where query time goes
+DECLARE_STATS_GROUP(TEXT("AimAssist"), STATGROUP_AimAssist, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Query Launch"), STAT_AimAssist_Query, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Solver: Snapshot"), STAT_AimAssist_SolverGather, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Select (Task)"), STAT_AimAssist_Select, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stage: Score Kernel"), STAT_AimAssist_StageScore, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stage: Range/FOV/Targetable"), STAT_AimAssist_StageFilter, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stage: Top-K"), STAT_AimAssist_StageTopK, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stage: LOS Submit"), STAT_AimAssist_StageLOS, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resolve"), STAT_AimAssist_Resolve, STATGROUP_AimAssist, TETHERED_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Players Queried"), STAT_AimAssist_PlayersQueried, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Candidates Gathered"), STAT_AimAssist_Candidates, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rejected: Range"), STAT_AimAssist_RejectedRange, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rejected: FOV"), STAT_AimAssist_RejectedFOV, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rejected: Targetable"), STAT_AimAssist_RejectedTargetable, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rejected: Top-K"), STAT_AimAssist_RejectedTopK, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rejected: LOS"), STAT_AimAssist_RejectedLOS, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOS Traces"), STAT_AimAssist_LOSTraces, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOS Shared"), STAT_AimAssist_LOSShared, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOS From Grid"), STAT_AimAssist_LOSGrid, STATGROUP_AimAssist, TETHERED_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Max Query Rate (Hz)"), STAT_AimAssist_QueryRate, STATGROUP_AimAssist, TETHERED_API);
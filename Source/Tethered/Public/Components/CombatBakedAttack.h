@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ICombatAttacker;
+class UCombatMontageBake;
+class USkeletalMeshComponent;
+
+/**
+ *  Plays a baked attack montage without animation, shared by the player and enemies.
+ *  Advancing the playhead fires the baked combat events on the attacker in time order, follows the montage's
+ *  section links and applies section jumps requested by those events. Damage bones are sampled from the baked
+ *  tracks and placed with the mesh component transform, so the skeletal pose never has to be evaluated.
+ */
+struct TETHERED_API FCombatBakedAttack
+{
+	/** Starts playing the bake from the given section, or its first section. Returns false if there is nothing to play */
+	bool Play(const UCombatMontageBake* InBake, FName StartSection = NAME_None, float InPlayRate = 1.0f);
+
+	/** Requests a jump to the named section, applied on the next advance like Montage_JumpToSection */
+	void JumpToSection(FName SectionName);
+
+	/** Stops playback, closing any open swing window on the attacker */
+	void Stop(ICombatAttacker& Attacker);
+
+	/** Moves the playhead and fires the events it passes. Returns false once the attack has finished */
+	bool Advance(float DeltaTime, ICombatAttacker& Attacker);
+
+	/** Returns true while an attack is playing */
+	bool IsPlaying() const { return SectionIndex != INDEX_NONE; }
+
+	/** Returns the bake currently playing, if any */
+	const UCombatMontageBake* GetBake() const { return IsPlaying() ? Bake.Get() : nullptr; }
+
+	/** Gets the world position of a damage bone at the playhead. Returns false if the bake has no track for it */
+	bool SampleBone(FName BoneName, const USkeletalMeshComponent& Mesh, FVector& OutLocation) const;
+
+private:
+
+	/** Enters a section at its start */
+	void EnterSection(int32 NewSectionIndex);
+
+	/** Closes the open swing window, sweeping its last stretch first */
+	void CloseSwing(ICombatAttacker& Attacker);
+
+	/** Bake being played */
+	TWeakObjectPtr<const UCombatMontageBake> Bake;
+
+	/** Current section, or INDEX_NONE when stopped */
+	int32 SectionIndex = INDEX_NONE;
+
+	/** Section requested by JumpToSection, or INDEX_NONE */
+	int32 PendingSectionIndex = INDEX_NONE;
+
+	/** Playhead time from the start of the current section */
+	float Time = 0.0f;
+
+	/** Next event of the current section to fire */
+	int32 NextNotify = 0;
+
+	float PlayRate = 1.0f;
+
+	/** True between a swing begin and its end */
+	bool bSwingOpen = false;
+};
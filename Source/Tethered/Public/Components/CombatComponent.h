@@ -6,9 +6,14 @@
 #include "Components/ActorComponent.h"
 #include "Interfaces/CombatAttacker.h"
 #include "Animation/AnimInstance.h"
+#include "Components/MeleeSwingTrace.h"
+#include "Components/CombatBakedAttack.h"
+#include "Engine/StreamableManager.h"
 #include "CombatComponent.generated.h"
 
 class ATetheredCharacter;
+class UDebugDrawSubsystem;
+class UCombatMontageBake;
 
 DECLARE_DELEGATE_TwoParams(FOnAttackMontageEnded, UAnimMontage*, bool);
 
@@ -45,7 +50,11 @@ public:
 
 	/** AnimMontage that will play for combo attacks */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Combo")
-	UAnimMontage* ComboAttackMontage;
+	TSoftObjectPtr<UAnimMontage> ComboAttackMontage;
+
+	/** Baked form of the combo attack montage, used on dedicated servers instead of playing the montage */
+	UPROPERTY(EditAnywhere, Category="Melee Attack|Combo")
+	UCombatMontageBake* ComboAttackBake;
 
 	/** Names of the AnimMontage sections that correspond to each stage of the combo attack */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Combo")
@@ -57,7 +66,11 @@ public:
 
 	/** AnimMontage that will play for charged attacks */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Charged")
-	UAnimMontage* ChargedAttackMontage;
+	TSoftObjectPtr<UAnimMontage> ChargedAttackMontage;
+
+	/** Baked form of the charged attack montage, used on dedicated servers instead of playing the montage */
+	UPROPERTY(EditAnywhere, Category="Melee Attack|Charged")
+	UCombatMontageBake* ChargedAttackBake;
 
 	/** Name of the AnimMontage section that corresponds to the charge loop */
 	UPROPERTY(EditAnywhere, Category="Melee Attack|Charged")
@@ -95,6 +108,18 @@ private:
 
 	/** Attack montage ended delegate */
 	FOnMontageEnded OnAttackMontageEnded;
+
+	/** Continuous sweep for the open attack swing window */
+	FMeleeSwingTrace SwingTrace;
+
+	/** Reused list of new hits from the swing sweep */
+	TArray<FHitResult> SwingHits;
+
+	/** Animation-free attack playback, when running from bakes */
+	FCombatBakedAttack BakedAttack;
+
+	/** Keeps the attack montages loaded */
+	TSharedPtr<FStreamableHandle> MontageLoadHandle;
 #pragma endregion Internal State
 
 #pragma region Core Interface
@@ -105,6 +130,8 @@ protected:
 	virtual void BeginPlay() override;
 
 public:
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
 	/** Initialize the component with its owner */
 	void Initialize(ATetheredCharacter* InOwnerCharacter);
 
@@ -148,6 +175,21 @@ protected:
 
 	/** Called from a delegate when the attack montage ends */
 	void AttackMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+
+	/** Returns true if attacks should run from bakes instead of animation */
+	bool ShouldUseBakedAttacks() const;
+
+	/** Plays an attack from its bake or its montage. Returns true if the attack started */
+	bool PlayAttack(const TSoftObjectPtr<UAnimMontage>& MontagePtr, UCombatMontageBake* Bake);
+
+	/** Jumps the playing attack to the given section */
+	void JumpToAttackSection(FName SectionName, UAnimMontage* Montage);
+
+	/** Gets the world position of a damage source bone, from the bake when one is playing */
+	FVector GetDamageSourceLocation(FName DamageSourceBone) const;
+
+	/** Applies damage, knockback and debug feedback for a single melee hit */
+	void ApplyMeleeHit(const FHitResult& Hit, UDebugDrawSubsystem* DebugDraw);
 #pragma endregion Combat Actions
 
 #pragma region ICombatAttacker Interface
@@ -155,6 +197,15 @@ public:
 	/** Performs the collision check for an attack */
 	virtual void DoAttackTrace(FName DamageSourceBone) override;
 
+	/** Opens an attack swing window following the given bone */
+	virtual void BeginAttackSwing(FName DamageSourceBone) override;
+
+	/** Sweeps the open attack swing since the last frame */
+	virtual void TickAttackSwing() override;
+
+	/** Closes the attack swing window */
+	virtual void EndAttackSwing() override;
+
 	/** Performs the combo string check */
 	virtual void CheckCombo() override;
 
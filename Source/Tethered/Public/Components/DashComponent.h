@@ -5,6 +5,7 @@
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
 #include "DashComponent.generated.h"
 
 class ATetheredCharacter;
@@ -19,7 +20,7 @@ class TETHERED_API UDashComponent : public UActorComponent
 public:
 	/** AnimMontage to use for the Dash action */
 	UPROPERTY(EditAnywhere, Category="Dash")
-	UAnimMontage* DashMontage;
+	TSoftObjectPtr<UAnimMontage> DashMontage;
 
 	/** Maximum distance the character can dash */
 	UPROPERTY(EditAnywhere, Category="Dash", meta = (ClampMin = 0, ClampMax = 2000, Units = "cm"))
@@ -69,6 +70,9 @@ private:
 
 	/** Dash montage ended delegate */
 	FOnMontageEnded OnDashMontageEnded;
+
+	/** Keeps the dash montage loaded */
+	TSharedPtr<FStreamableHandle> MontageLoadHandle;
 #pragma endregion Internal State
 
 #pragma region Core Interface
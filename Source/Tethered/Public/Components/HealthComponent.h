@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "UI/HUDViewModel.h"
 #include "HealthComponent.generated.h"
 
 class ATetheredCharacter;
@@ -51,6 +52,9 @@ private:
 	UPROPERTY()
 	UCombatLifeBar* LifeBarWidget;
 
+	/** Life bar values waiting for the once per frame HUD flush */
+	FLifeBarViewModel LifeBarViewModel;
+
 	/** Character respawn timer */
 	FTimerHandle RespawnTimer;
 
@@ -111,7 +115,10 @@ protected:
 	/** Called from the respawn timer to destroy and re-create the character */
 	void RespawnCharacter();
 
-	/** Updates the life bar UI */
+	/** Queues a life bar UI update for the end of the frame */
 	void UpdateLifeBarUI();
+
+	/** Removes the owner's mesh from the ragdoll budget */
+	void ReleaseRagdoll();
 #pragma endregion Health Management
 };
\ No newline at end of file
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+#include "Subsystems/HurtboxRegistrySubsystem.h"
+
+class USkeletalMeshComponent;
+class USkeletalMeshSocket;
+class UWorld;
+
+/**
+ *  Continuous melee swing shared by the player and enemies.
+ *  A swing follows one bone or socket for the length of an attack window. Every advance sweeps from where the bone
+ *  was on the previous sample to where it is now, so fast swings and low frame rates don't skip over targets, and
+ *  each actor is reported at most once per swing no matter how many sweeps touch it.
+ */
+struct TETHERED_API FMeleeSwingTrace
+{
+	/** Starts a new swing following the given bone or socket. The lookup is cached until the mesh or name changes */
+	void Begin(USkeletalMeshComponent* InMesh, FName InSourceName);
+
+	/** Ends the current swing */
+	void End();
+
+	/** Returns true while a swing is running */
+	bool IsActive() const { return bActive; }
+
+	/**
+	 *  Sweeps a sphere from the last sampled bone position to the current one against the given factions' hurtboxes.
+	 *  Returns true if any actor not already hit during this swing was found, with one hit per new actor in OutNewHits.
+	 */
+	bool Advance(UWorld& World, EHurtboxFaction Targets, float Radius, const AActor* IgnoreActor, TArray<FHitResult>& OutNewHits);
+
+	/** Same as Advance, but sweeps to a location supplied by the caller instead of sampling the mesh pose */
+	bool AdvanceTo(UWorld& World, const FVector& Current, EHurtboxFaction Targets, float Radius, const AActor* IgnoreActor, TArray<FHitResult>& OutNewHits);
+
+	/** Bone or socket followed by the current swing */
+	FName GetSourceName() const { return SourceName; }
+
+	/** Start of the segment swept by the last advance */
+	const FVector& GetSegmentStart() const { return SegmentStart; }
+
+	/** End of the segment swept by the last advance */
+	const FVector& GetSegmentEnd() const { return SegmentEnd; }
+
+private:
+
+	/** Returns the current world location of the followed bone or socket */
+	FVector SampleLocation(const USkeletalMeshComponent& MeshComp) const;
+
+	/** Mesh the swing follows */
+	TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+
+	/** Skeletal mesh asset the cached lookup was resolved against */
+	TWeakObjectPtr<const UObject> ResolvedAsset;
+
+	/** Bone or socket name the cached lookup was resolved for */
+	FName SourceName;
+
+	/** Cached bone index, or INDEX_NONE when following a socket */
+	int32 BoneIndex = INDEX_NONE;
+
+	/** Cached socket, when the name refers to a socket rather than a bone */
+	const USkeletalMeshSocket* Socket = nullptr;
+
+	/** Bone position from the previous sample */
+	FVector LastLocation = FVector::ZeroVector;
+
+	/** Segment swept by the last advance */
+	FVector SegmentStart = FVector::ZeroVector;
+	FVector SegmentEnd = FVector::ZeroVector;
+
+	/** Actors already hit during this swing */
+	TArray<TObjectKey<AActor>, TInlineAllocator<8>> HitActors;
+
+	/** Reused sweep results */
+	TArray<FHitResult> SweepHits;
+
+	bool bActive = false;
+	bool bHasSample = false;
+};
@@ -2,8 +2,49 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "Curves/CurveFloat.h"
 #include "AimAssistProfile.generated.h"
 
+/**
+ * Flat runtime form of an aim assist profile.
+ * Built whenever the profile loads or is edited, so per-tick code only reads precomputed thresholds and samples lookup tables.
+ */
+struct FAimAssistCompiledProfile
+{
+	/** Number of segments in each lookup table; tables hold one more sample than this */
+	static constexpr int32 LUTSegments = 32;
+
+	// Query
+	float RangeCm = 0.f;
+	float InvRangeCm = 0.f;
+	float CosQueryFOV = 0.f;
+	float Stickiness = 0.f;
+	float HysteresisMultiplier = 1.f;
+
+	// Assist
+	float CosSnapCone = 1.f;
+	float SnapConeDeg = 0.f;
+	float MaxSnapDeg = 0.f;
+	float MaxYawDegPerSec = 0.f;
+
+	/** Assist strength by aim input magnitude (0-1) */
+	float StickStrengthLUT[LUTSegments + 1] = {};
+
+	/** Assist multiplier by distance as a fraction of the assist range (0-1) */
+	float DistanceFalloffLUT[LUTSegments + 1] = {};
+
+	/** Assist multiplier by angle to the target as a fraction of 180 degrees (0-1) */
+	float AngleFalloffLUT[LUTSegments + 1] = {};
+
+	/** Linearly samples a lookup table at X in [0, 1] */
+	static float Sample(const float (&LUT)[LUTSegments + 1], float X)
+	{
+		const float T = FMath::Clamp(X, 0.f, 1.f) * LUTSegments;
+		const int32 Index = FMath::Min(static_cast<int32>(T), LUTSegments - 1);
+		return FMath::Lerp(LUT[Index], LUT[Index + 1], T - Index);
+	}
+};
+
 /**
  * Data asset that defines aim assist behavior parameters.
  * Create instances of this asset to configure different aim assist profiles for various scenarios.
@@ -33,6 +74,26 @@ public:
 		ToolTip = "Target stickiness factor (0-1). Higher values make it harder to switch targets, preventing jitter. Recommended: 0.4-0.8."))
 	float Stickiness = 0.6f;
 
+	// Response Curves - Optional designer curves; leave a curve empty to keep the default response
+	
+	/** Assist strength by aim input magnitude (X: 0-1 stick deflection, Y: strength multiplier). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Curves",
+		meta = (XAxisName = "Stick", YAxisName = "Strength",
+		ToolTip = "Rotational assist strength by stick deflection. Empty = linear from 1 at rest to 0.25 at full deflection, so light input gets the most help."))
+	FRuntimeFloatCurve StickStrengthCurve;
+
+	/** Assist falloff by distance to the target (X: 0-1 fraction of AssistRangeCm, Y: multiplier). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Curves",
+		meta = (XAxisName = "Distance / Range", YAxisName = "Multiplier",
+		ToolTip = "Scales rotational assist by how far the target is, as a fraction of the assist range. Empty = no falloff."))
+	FRuntimeFloatCurve DistanceFalloffCurve;
+
+	/** Assist falloff by angle to the target (X: 0-1 fraction of 180 degrees, Y: multiplier). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Curves",
+		meta = (XAxisName = "Angle / 180", YAxisName = "Multiplier",
+		ToolTip = "Scales rotational assist by how far off-facing the target is, as a fraction of 180 degrees. Empty = no falloff."))
+	FRuntimeFloatCurve AngleFalloffCurve;
+
 	// Assist Settings - Controls how aim assistance behaves
 	
 	/** Angle in degrees within which aim friction is applied to slow down crosshair movement. */
@@ -110,4 +171,22 @@ public:
 		meta = (ClampMin = "0", ClampMax = "90", Units = "deg",
 		ToolTip = "Maximum auto-turn during melee attacks. Helps ensure attacks connect with nearby targets. Too high values may feel disorienting. Recommended: 15-45 degrees."))
 	float MeleeMaxTurnOnAttack = 30.f;
-};
\ No newline at end of file
+
+	/** Returns the compiled runtime form of this profile */
+	const FAimAssistCompiledProfile& GetCompiled() const { return Compiled; }
+
+	/** Rebuilds the compiled runtime form from the current settings */
+	void Compile();
+
+	// ~begin UObject interface
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	// ~end UObject interface
+
+private:
+	/** Flat runtime form, rebuilt on load and on edit */
+	FAimAssistCompiledProfile Compiled;
+};
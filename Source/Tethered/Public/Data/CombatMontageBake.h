@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "CombatMontageBake.generated.h"
+
+class UAnimMontage;
+class USkeletalMesh;
+
+/** Combat events extracted from an attack montage's notifies */
+UENUM()
+enum class ECombatBakedEvent : uint8
+{
+	/** AnimNotify_DoAttackTrace */
+	AttackTrace,
+
+	/** AnimNotify_CheckCombo */
+	CheckCombo,
+
+	/** AnimNotify_CheckChargedAttack */
+	CheckChargedAttack,
+
+	/** Start of an AnimNotifyState_AttackSwing window */
+	SwingBegin,
+
+	/** End of an AnimNotifyState_AttackSwing window */
+	SwingEnd
+};
+
+/** A single combat event, timed from the start of its section */
+USTRUCT()
+struct FCombatBakedNotify
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	float Time = 0.0f;
+
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	ECombatBakedEvent Event = ECombatBakedEvent::AttackTrace;
+
+	/** Damage source bone or socket, for trace and swing events */
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	FName BoneName;
+};
+
+/** Mesh component space positions of one damage source bone, sampled at a fixed rate from the start of its section */
+USTRUCT()
+struct FCombatBakedTrack
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	FName BoneName;
+
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	TArray<FVector3f> Positions;
+};
+
+/** Everything combat needs from one montage section */
+USTRUCT()
+struct FCombatBakedSection
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	FName SectionName;
+
+	/** Section that plays after this one, or None if the montage ends here */
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	FName NextSectionName;
+
+	/** Section length in seconds at play rate 1 */
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	float Length = 0.0f;
+
+	/** Combat events sorted by time */
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	TArray<FCombatBakedNotify> Notifies;
+
+	/** One track per damage source bone used by this section's events */
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	TArray<FCombatBakedTrack> Tracks;
+};
+
+/**
+ *  Animation-free form of an attack montage: section flow, combat notify timings and damage bone trajectories.
+ *  Written by the CombatMontageBake commandlet so dedicated servers and unrendered enemies can run attacks
+ *  without evaluating skeletal animation.
+ */
+UCLASS(BlueprintType)
+class TETHERED_API UCombatMontageBake : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Montage this bake was extracted from */
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	TSoftObjectPtr<UAnimMontage> SourceMontage;
+
+	/** Skeletal mesh the bone positions were evaluated on */
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	TSoftObjectPtr<USkeletalMesh> SourceMesh;
+
+	/** Track samples per second */
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	float SampleRate = 30.0f;
+
+	/** Montage sections in authored order */
+	UPROPERTY(VisibleAnywhere, Category="Bake")
+	TArray<FCombatBakedSection> Sections;
+
+	/** Returns the index of the named section, or INDEX_NONE */
+	int32 FindSectionIndex(FName SectionName) const;
+
+	/** Interpolates a bone's mesh space position in a section. Returns false if the section has no track for it */
+	bool SampleBone(int32 SectionIndex, FName BoneName, float Time, FVector& OutMeshSpaceLocation) const;
+
+#if WITH_EDITOR
+	/** Rebuilds this bake from a montage evaluated on the given mesh. Returns false if nothing could be extracted */
+	bool BakeFrom(UAnimMontage* Montage, USkeletalMesh* Mesh, float InSampleRate);
+#endif
+};
@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/StreamableManager.h"
+#include "VariantAssetBundles.generated.h"
+
+/**
+ *  Primary asset listing the soft-referenced content of each game variant.
+ *  Every list is tagged with its variant's Asset Manager bundle (Combat, Platforming, SideScrolling), so a variant's
+ *  game mode brings in only its own montages and classes when the map starts, and nothing else stays resident.
+ */
+UCLASS(BlueprintType)
+class TETHERED_API UVariantAssetBundles : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Primary asset type these assets are scanned under */
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	/** Assets needed by the combat variant */
+	UPROPERTY(EditDefaultsOnly, Category="Combat", meta=(AssetBundles="Combat"))
+	TArray<TSoftObjectPtr<UObject>> CombatAssets;
+
+	/** Classes spawned at runtime by the combat variant */
+	UPROPERTY(EditDefaultsOnly, Category="Combat", meta=(AssetBundles="Combat"))
+	TArray<TSoftClassPtr<UObject>> CombatClasses;
+
+	/** Assets needed by the platforming variant */
+	UPROPERTY(EditDefaultsOnly, Category="Platforming", meta=(AssetBundles="Platforming"))
+	TArray<TSoftObjectPtr<UObject>> PlatformingAssets;
+
+	/** Classes spawned at runtime by the platforming variant */
+	UPROPERTY(EditDefaultsOnly, Category="Platforming", meta=(AssetBundles="Platforming"))
+	TArray<TSoftClassPtr<UObject>> PlatformingClasses;
+
+	/** Assets needed by the side scrolling variant */
+	UPROPERTY(EditDefaultsOnly, Category="SideScrolling", meta=(AssetBundles="SideScrolling"))
+	TArray<TSoftObjectPtr<UObject>> SideScrollingAssets;
+
+	/** Classes spawned at runtime by the side scrolling variant */
+	UPROPERTY(EditDefaultsOnly, Category="SideScrolling", meta=(AssetBundles="SideScrolling"))
+	TArray<TSoftClassPtr<UObject>> SideScrollingClasses;
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	/** Starts loading one bundle from every variant asset set. The content stays resident while the handle is held */
+	static TSharedPtr<FStreamableHandle> LoadBundle(FName BundleName);
+};
+
+namespace VariantAssets
+{
+	/** Starts an async load of the given paths, skipping null ones. Returns null if there is nothing to load */
+	TETHERED_API TSharedPtr<FStreamableHandle> RequestAsyncLoad(TArray<FSoftObjectPath> Paths);
+
+	/** Returns a soft-referenced object, loading it on the spot if its async load hasn't finished yet */
+	template<typename T>
+	T* Resolve(const TSoftObjectPtr<T>& Ptr)
+	{
+		if (Ptr.IsNull())
+		{
+			return nullptr;
+		}
+
+		T* Loaded = Ptr.Get();
+		return Loaded ? Loaded : Ptr.LoadSynchronous();
+	}
+
+	/** Returns a soft-referenced class, loading it on the spot if its async load hasn't finished yet */
+	template<typename T>
+	UClass* Resolve(const TSoftClassPtr<T>& Ptr)
+	{
+		if (Ptr.IsNull())
+		{
+			return nullptr;
+		}
+
+		UClass* Loaded = Ptr.Get();
+		return Loaded ? Loaded : Ptr.LoadSynchronous();
+	}
+}
@@ -0,0 +1,26 @@
+// AimAssistReplayCommandlet.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AimAssistReplayCommandlet.generated.h"
+
+/**
+ * Replays an aim assist decision capture through the scoring kernel and hysteresis without launching the game.
+ * Used to tune score weights and stickiness against real sessions and to benchmark the selection path.
+ *
+ * Usage: UnrealEditor-Cmd Tethered.uproject -run=AimAssistReplay [-Capture=<file>] [-WDist=] [-WAngle=] [-WVel=] [-WSticky=]
+ *        [-Stickiness=] [-Iterations=] [-Scalar]
+ * Without -Capture, the newest capture in Saved/AimAssist is used. Weights default to the ones recorded in the capture,
+ * and stickiness defaults to the value recorded with each query.
+ */
+UCLASS()
+class TETHERED_API UAimAssistReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAimAssistReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,27 @@
+// CombatMontageBakeCommandlet.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CombatMontageBakeCommandlet.generated.h"
+
+/**
+ * Bakes attack montages into UCombatMontageBake assets for animation-free server combat.
+ * Each bake is saved as <Montage>_Bake next to its montage and has to be assigned to the matching
+ * ComboAttackBake / ChargedAttackBake slot on the player and enemy Blueprints.
+ *
+ * Usage: UnrealEditor-Cmd Tethered.uproject -run=CombatMontageBake [-Montage=<object path>] [-Mesh=<object path>] [-SampleRate=]
+ * Without -Montage, every montage under /Game that carries combat notifies is baked.
+ * Without -Mesh, bone positions are evaluated on the preview mesh of the montage's skeleton.
+ * Re-run whenever an attack montage or its notifies change; stale bakes keep the old timings.
+ */
+UCLASS()
+class TETHERED_API UCombatMontageBakeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCombatMontageBakeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -43,6 +43,14 @@ public:
 	UFUNCTION(Exec, BlueprintCallable, Category = "Tethered|Aim Assist")
 	void ClearForcedAimAssistTarget();
 
+	/** Starts or stops recording aim assist decisions for offline replay */
+	UFUNCTION(Exec, BlueprintCallable, Category = "Tethered|Aim Assist")
+	void ToggleAimAssistRecording();
+
+	/** Toggles the baked visibility grids, forcing every aim assist LOS check to trace while off */
+	UFUNCTION(Exec, BlueprintCallable, Category = "Tethered|Aim Assist")
+	void ToggleAimAssistVisibilityGrid();
+
 #pragma endregion Aim Assist Debug Commands
 
 #pragma region Combat Debug Commands
@@ -59,6 +67,18 @@ public:
 	UFUNCTION(Exec, BlueprintCallable, Category = "Tethered|Combat")
 	void ShowCombatStatus();
 
+	/** Toggles the hurtbox registry, sending every melee sweep through physics scene queries while off */
+	UFUNCTION(Exec, BlueprintCallable, Category = "Tethered|Combat")
+	void ToggleHurtboxRegistry();
+
+	/** Sets how many ragdolls may simulate at once; extra ragdolls are frozen in place */
+	UFUNCTION(Exec, BlueprintCallable, Category = "Tethered|Combat")
+	void SetRagdollBudget(int32 MaxActiveRagdolls);
+
+	/** Sets how many enemy spawns may run per frame, and the time in milliseconds after which no more are started */
+	UFUNCTION(Exec, BlueprintCallable, Category = "Tethered|Combat")
+	void SetSpawnBudget(int32 MaxSpawnsPerFrame, float BudgetMs = 2.0f);
+
 #pragma endregion Combat Debug Commands
 
 #pragma region Utility Commands
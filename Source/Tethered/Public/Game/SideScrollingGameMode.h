@@ -3,7 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "GameFramework/GameModeBase.h"
+#include "Game/TetheredGameMode.h"
+#include "UI/HUDViewModel.h"
 #include "SideScrollingGameMode.generated.h"
 
 class USideScrollingUI;
@@ -14,10 +15,15 @@ class USideScrollingUI;
  *  Counts pickups collected by the player
  */
 UCLASS(abstract)
-class ASideScrollingGameMode : public AGameModeBase
+class ASideScrollingGameMode : public ATetheredGameMode
 {
 	GENERATED_BODY()
 	
+public:
+
+	/** Constructor */
+	ASideScrollingGameMode();
+
 protected:
 
 	/** Class of UI widget to spawn when the game starts */
@@ -32,6 +38,9 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category="Pickups")
 	int32 PickupsCollected = 0;
 
+	/** Pickup count waiting for the once per frame HUD flush */
+	FPickupCounterViewModel PickupsViewModel;
+
 protected:
 
 	/** Initialization */
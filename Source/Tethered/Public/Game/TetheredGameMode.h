@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameModeBase.h"
+#include "Engine/StreamableManager.h"
+#include "TetheredGameMode.generated.h"
+
+/**
+ *  Base GameMode shared by the game variants
+ *  Keeps the variant's Asset Manager bundle loaded while the map is running
+ */
+UCLASS(abstract)
+class ATetheredGameMode : public AGameModeBase
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Asset Manager bundle holding this variant's soft-referenced content. Set by each variant's constructor */
+	UPROPERTY(EditDefaultsOnly, Category="Assets")
+	FName AssetBundle;
+
+	/** Keeps the variant bundle resident for as long as the map is running */
+	TSharedPtr<FStreamableHandle> AssetBundleHandle;
+
+public:
+
+	/** Starts loading the variant bundle before any actor needs it */
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
+};
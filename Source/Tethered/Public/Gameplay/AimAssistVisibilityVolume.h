@@ -0,0 +1,185 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AimAssistVisibilityVolume.generated.h"
+
+class UBoxComponent;
+class UPrimitiveComponent;
+
+/** Baked answer for a pair of visibility grid cells */
+enum class EAimAssistBakedVisibility : uint8
+{
+	/** Not baked, partially occluded, or not safe to answer without a trace */
+	Unknown = 0,
+
+	/** Every sample trace between the two cells, at every sampled height, was clear of static geometry */
+	Visible = 1,
+
+	/** Every sample trace between the two cells, at every sampled height, was blocked by static geometry */
+	Blocked = 2
+};
+
+/**
+ *  Coarse cell-to-cell visibility grid for a static combat arena.
+ *  Place one over the arena and press Bake Visibility in the details panel. The box is split into 2D cells,
+ *  each cell finds the floor below it, and every pair of cells is classified by tracing against static geometry
+ *  only, between several heights above both floors. The aim assist solver asks the grid before issuing a LOS trace
+ *  and only falls back to a real trace when the grid can't answer or a dynamic blocker sits along the segment.
+ */
+UCLASS()
+class TETHERED_API AAimAssistVisibilityVolume : public AActor
+{
+	GENERATED_BODY()
+
+	/** Bounds of the baked grid */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Components", meta = (AllowPrivateAccess = "true"))
+	UBoxComponent* Box;
+
+protected:
+
+	/** Size of a grid cell in cm. Smaller cells give more exact answers at a quadratic memory and bake cost */
+	UPROPERTY(EditAnywhere, Category="Visibility Grid", meta = (ClampMin = 50, Units = "Centimeters"))
+	float CellSize = 200.0f;
+
+	/** Lowest height above the floor that cell samples are traced from. Lower LOS endpoints can't be answered by the grid */
+	UPROPERTY(EditAnywhere, Category="Visibility Grid", meta = (ClampMin = 0, Units = "Centimeters"))
+	float MinSampleHeight = 20.0f;
+
+	/** Highest height above the floor that cell samples are traced from. Higher LOS endpoints can't be answered by the grid */
+	UPROPERTY(EditAnywhere, Category="Visibility Grid", meta = (ClampMin = 0, Units = "Centimeters"))
+	float MaxSampleHeight = 180.0f;
+
+	/** Heights sampled evenly between the min and max, at both ends of a pair. Bake cost grows with the square of this */
+	UPROPERTY(EditAnywhere, Category="Visibility Grid", meta = (ClampMin = 2, ClampMax = 5))
+	int32 NumSampleHeights = 3;
+
+	/** Cell pairs further apart than this are left unbaked. Should cover the longest aim assist range */
+	UPROPERTY(EditAnywhere, Category="Visibility Grid", meta = (ClampMin = 0, Units = "Centimeters"))
+	float MaxBakeDistance = 5000.0f;
+
+	/** Channel the grid is baked for. Queries on any other channel always fall back to a trace */
+	UPROPERTY(EditAnywhere, Category="Visibility Grid")
+	TEnumAsByte<ECollisionChannel> BakeChannel = ECC_Visibility;
+
+	/** Baking is refused above this many cells, since pair storage grows with the square of the cell count */
+	UPROPERTY(EditAnywhere, Category="Visibility Grid", meta = (ClampMin = 1))
+	int32 MaxCells = 4096;
+
+	/** Number of cells along X in the last bake */
+	UPROPERTY(VisibleAnywhere, Category="Visibility Grid|Baked")
+	int32 NumCellsX = 0;
+
+	/** Number of cells along Y in the last bake */
+	UPROPERTY(VisibleAnywhere, Category="Visibility Grid|Baked")
+	int32 NumCellsY = 0;
+
+	/** World space XY corner of cell (0, 0) in the last bake */
+	UPROPERTY(VisibleAnywhere, Category="Visibility Grid|Baked")
+	FVector2D GridOrigin = FVector2D::ZeroVector;
+
+	/** Cell size used by the last bake */
+	UPROPERTY(VisibleAnywhere, Category="Visibility Grid|Baked")
+	float BakedCellSize = 0.0f;
+
+	/** Channel used by the last bake */
+	UPROPERTY(VisibleAnywhere, Category="Visibility Grid|Baked")
+	TEnumAsByte<ECollisionChannel> BakedChannel = ECC_Visibility;
+
+	/** Height band above the floor covered by the last bake */
+	UPROPERTY(VisibleAnywhere, Category="Visibility Grid|Baked")
+	FVector2f BakedHeightRange = FVector2f::ZeroVector;
+
+	/** Floor height of every cell, or unset where no floor was found */
+	UPROPERTY()
+	TArray<float> CellFloorZ;
+
+	/** Cells that found a floor during the bake */
+	UPROPERTY()
+	TArray<bool> CellHasFloor;
+
+	/** Two bits per unordered cell pair, packed over the upper triangle of the pair matrix */
+	UPROPERTY()
+	TArray<uint8> PairVisibility;
+
+public:
+
+	/** Constructor */
+	AAimAssistVisibilityVolume();
+
+	/**
+	 *  Answers a LOS query from the baked grid. Endpoints outside the baked height band are Unknown.
+	 *  Blocked is final since dynamic objects can only add occlusion. Visible is downgraded to Unknown
+	 *  when a dynamic blocker overlaps a cell along the segment.
+	 */
+	EAimAssistBakedVisibility QueryVisibility(const FVector& From, const FVector& To, ECollisionChannel Channel);
+
+	/** Returns true if the grid holds baked data. Grids baked before the height band was added need a rebake */
+	bool HasBakedData() const { return !PairVisibility.IsEmpty() && CellFloorZ.Num() == NumCellsX * NumCellsY; }
+
+	/** Adds a movable blocker spawned after BeginPlay, so the grid stops vouching for segments through it */
+	void AddDynamicBlocker(UPrimitiveComponent* Blocker);
+
+#if WITH_EDITOR
+	/** Rebuilds the visibility grid from the static geometry inside the box */
+	UFUNCTION(CallInEditor, Category="Visibility Grid")
+	void BakeVisibility();
+
+	/** Discards the baked grid */
+	UFUNCTION(CallInEditor, Category="Visibility Grid")
+	void ClearVisibility();
+#endif
+
+protected:
+
+	/** Registers with the aim assist solver and collects dynamic blockers */
+	virtual void BeginPlay() override;
+
+	/** Unregisters from the aim assist solver and stops watching for spawned blockers */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+
+	/** Returns the index of the cell containing the location, or INDEX_NONE outside the grid */
+	int32 GetCellIndex(const FVector& Location) const;
+
+	/** Returns the bit offset of an unordered cell pair in PairVisibility */
+	int64 GetPairBit(int32 CellA, int32 CellB) const;
+
+	/** Reads the baked value for a cell pair */
+	EAimAssistBakedVisibility GetPair(int32 CellA, int32 CellB) const;
+
+	/** Marks the cells overlapped by dynamic blockers. Runs at most once per frame */
+	void RefreshDynamicCells();
+
+	/** Returns the world space XY center of a cell */
+	FVector2D GetCellCenter(int32 Cell) const;
+
+	/** Adds the movable blocking components of an actor spawned after BeginPlay */
+	void OnActorSpawned(AActor* SpawnedActor);
+
+	/** Returns true if the 2D segment crosses a cell marked by a dynamic blocker */
+	bool SegmentTouchesDynamicCell(const FVector& From, const FVector& To) const;
+
+#if WITH_EDITOR
+	/** Writes the baked value for a cell pair */
+	void SetPair(int32 CellA, int32 CellB, EAimAssistBakedVisibility Value);
+
+	/** Traces against static geometry only, skipping past movable hits. Returns Unknown if it gives up */
+	EAimAssistBakedVisibility TraceStatic(const FVector& From, const FVector& To, FHitResult* OutHit = nullptr) const;
+#endif
+
+	/** Movable components inside the grid that block the baked channel */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> DynamicBlockers;
+
+	/** One flag per cell, set while a dynamic blocker overlaps it */
+	TBitArray<> DynamicCells;
+
+	/** Frame the dynamic cells were last refreshed on */
+	uint64 DynamicCellsFrame = 0;
+
+	/** Handle of the world's actor spawned callback */
+	FDelegateHandle ActorSpawnedHandle;
+};
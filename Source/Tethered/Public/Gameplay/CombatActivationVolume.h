@@ -10,6 +10,7 @@ class UBoxComponent;
 
 /**
  *  A simple volume that activates a list of actors when the player pawn enters.
+ *  A larger prefetch box around it lets those actors start loading their content while the player approaches.
  */
 UCLASS()
 class ACombatActivationVolume : public AActor
@@ -19,6 +20,10 @@ class ACombatActivationVolume : public AActor
 	/** Collision box volume */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Components", meta = (AllowPrivateAccess = "true"))
 	UBoxComponent* Box;
+
+	/** Box around the volume that triggers prefetching as the player approaches */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Components", meta = (AllowPrivateAccess = "true"))
+	UBoxComponent* PrefetchBox;
 	
 protected:
 
@@ -26,15 +31,29 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Activation Volume")
 	TArray<AActor*> ActorsToActivate;
 
+	/** How far outside the volume the player starts prefetching the actors' content */
+	UPROPERTY(EditAnywhere, Category="Activation Volume", meta = (ClampMin = 0, ClampMax = 10000, Units = "cm"))
+	float PrefetchDistance = 1500.0f;
+
+	/** Flag to ensure the actors are only prefetched once */
+	bool bHasPrefetched = false;
+
 public:	
 	
 	/** Constructor */
 	ACombatActivationVolume();
 
+	/** Sizes the prefetch box around the volume */
+	virtual void OnConstruction(const FTransform& Transform) override;
+
 protected:
 
 	/** Handles overlaps with the box volume */
 	UFUNCTION()
 	void OnOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+	/** Handles overlaps with the prefetch box */
+	UFUNCTION()
+	void OnPrefetchOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
 };
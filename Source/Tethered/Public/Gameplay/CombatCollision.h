@@ -0,0 +1,26 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+/**
+ *  Project collision scheme for combat queries. Mirrors the channels and profiles in DefaultEngine.ini.
+ *  Characters carry a query only hurtbox on their faction's object channel. Melee normally resolves against
+ *  the hurtbox registry; these channels serve the physics fallback and anything else that needs to find
+ *  one faction through the scene without seeing capsules, meshes, triggers or pickups.
+ */
+namespace CombatCollision
+{
+	/** Object channel of the player's hurtbox */
+	inline constexpr ECollisionChannel PlayerHurtbox = ECC_GameTraceChannel2;
+
+	/** Object channel of enemy hurtboxes */
+	inline constexpr ECollisionChannel EnemyHurtbox = ECC_GameTraceChannel3;
+
+	/** Collision profile names */
+	inline const FName PlayerHurtboxProfile = FName("PlayerHurtbox");
+	inline const FName EnemyHurtboxProfile = FName("EnemyHurtbox");
+	inline const FName DamageablePropProfile = FName("DamageableProp");
+}
@@ -50,6 +50,9 @@ protected:
 
 public:
 
+	/** BeginPlay initialization */
+	virtual void BeginPlay() override;
+
 	/** EndPlay cleanup */
 	void EndPlay(EEndPlayReason::Type EndPlayReason) override;
 
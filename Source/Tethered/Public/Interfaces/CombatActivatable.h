@@ -33,4 +33,7 @@ public:
 	/** Deactivates the Interactable Actor */
 	UFUNCTION(BlueprintCallable, Category="Activatable")
 	virtual void DeactivateInteraction(AActor* ActivationInstigator) = 0;
+
+	/** Called ahead of activation so the actor can start loading what it will need. Does nothing by default */
+	virtual void PrefetchInteraction(AActor* ActivationInstigator) {}
 };
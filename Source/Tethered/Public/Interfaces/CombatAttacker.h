@@ -26,6 +26,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void DoAttackTrace(FName DamageSourceBone) = 0;
 
+	/** Opens a continuous attack swing that follows the given bone. Usually called from a montage's AnimNotifyState */
+	UFUNCTION(BlueprintCallable, Category="Attacker")
+	virtual void BeginAttackSwing(FName DamageSourceBone) = 0;
+
+	/** Sweeps the open attack swing from the bone's previous position to its current one */
+	UFUNCTION(BlueprintCallable, Category="Attacker")
+	virtual void TickAttackSwing() = 0;
+
+	/** Closes the open attack swing */
+	UFUNCTION(BlueprintCallable, Category="Attacker")
+	virtual void EndAttackSwing() = 0;
+
 	/** Performs a combo attack's check to continue the string. Usually called from a montage's AnimNotify */
 	UFUNCTION(BlueprintCallable, Category="Attacker")
 	virtual void CheckCombo() = 0;
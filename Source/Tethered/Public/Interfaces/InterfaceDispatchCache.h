@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ICombatDamageable;
+
+/**
+ *  Per-class cache of how an actor implements the gameplay interfaces queried in hot paths.
+ *  Each UClass is resolved once: whether it implements IAimable and ICombatDamageable natively,
+ *  where the native interface lives in the object, and which IAimable functions are Blueprint overrides.
+ *  After that, dispatch is a map lookup plus either a direct virtual call or a single ProcessEvent.
+ *  The cache holds raw UFunction pointers, so it is dropped on hot reload, Blueprint reinstancing and world cleanup.
+ *  Game thread only.
+ */
+class TETHERED_API FInterfaceDispatchCache
+{
+public:
+
+	/** Returns true if the actor implements IAimable natively or in Blueprint */
+	static bool IsAimable(const AActor* Actor);
+
+	/** Calls IAimable::GetAimPointComponent. Returns nullptr if the actor isn't aimable */
+	static USceneComponent* GetAimPointComponent(AActor* Actor);
+
+	/** Calls IAimable::CanBeTargeted. Returns true if the actor isn't aimable or doesn't answer */
+	static bool CanBeTargeted(AActor* Actor);
+
+	/** Returns the native ICombatDamageable of the actor, or nullptr */
+	static ICombatDamageable* GetDamageable(AActor* Actor);
+
+	/** Drops every cached class */
+	static void Reset();
+
+	/** Resets the cache whenever cached classes or functions may go stale. Called on module startup */
+	static void RegisterResetDelegates();
+
+	/** Unbinds the delegates bound by RegisterResetDelegates. Called on module shutdown */
+	static void UnregisterResetDelegates();
+
+private:
+
+	/** Resolved interface layout of a single class */
+	struct FClassDispatch
+	{
+		/** True if the class implements IAimable natively or in Blueprint */
+		bool bIsAimable = false;
+
+		/** Byte offset of the native IAimable in the object, or INDEX_NONE */
+		int32 AimableOffset = INDEX_NONE;
+
+		/** Blueprint overrides of the IAimable functions; null means call the native implementation */
+		UFunction* GetAimPointComponentOverride = nullptr;
+		UFunction* CanBeTargetedOverride = nullptr;
+
+		/** Byte offset of the native ICombatDamageable in the object, or INDEX_NONE */
+		int32 DamageableOffset = INDEX_NONE;
+	};
+
+	/** Finds or builds the dispatch entry for the object's class */
+	static const FClassDispatch& Resolve(const UObject* Object);
+
+	/** Returns the interface pointer at a cached offset */
+	template<typename InterfaceType>
+	static InterfaceType* AtOffset(const UObject* Object, int32 Offset)
+	{
+		return Offset != INDEX_NONE ? reinterpret_cast<InterfaceType*>(reinterpret_cast<uint8*>(const_cast<UObject*>(Object)) + Offset) : nullptr;
+	}
+
+	/** Dispatch entries keyed by class */
+	static TMap<TObjectKey<UClass>, FClassDispatch> Classes;
+
+	/** Handles of the delegates that reset the cache */
+	static FDelegateHandle ReloadCompleteHandle;
+	static FDelegateHandle ObjectsReinstancedHandle;
+	static FDelegateHandle WorldCleanupHandle;
+};
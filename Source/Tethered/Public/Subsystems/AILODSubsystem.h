@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AILODSubsystem.generated.h"
+
+class APawn;
+
+/** AI level of detail buckets, from most to least significant */
+enum class EAILOD : uint8
+{
+	/** Close to a player, recently damaged or just spawned: full rate */
+	High,
+
+	/** On screen or within mid range */
+	Medium,
+
+	/** Off screen at long range */
+	Low,
+
+	/** Off screen and out of any player's reach */
+	Dormant,
+
+	Num
+};
+
+/** Settings for one AI LOD bucket */
+struct FAILODBucket
+{
+	/** Pawns farther than this from every player fall into a lower bucket */
+	float MaxDistance;
+
+	/** Tick interval for the StateTree brain component, 0 for every frame */
+	float StateTreeTickInterval;
+
+	/** Tick interval for the AI controller, 0 for every frame */
+	float ControllerTickInterval;
+};
+
+/**
+ *  Throttles AI thinking by significance.
+ *  Registered AI pawns are managed by the Significance Manager, using every player's pawn as a viewpoint. Each pawn is
+ *  put in an LOD bucket from its distance to the nearest player and whether it's on screen, and the bucket sets the
+ *  tick interval of its StateTree brain and AI controller. Movement and animation are left alone, so throttled AI
+ *  still moves smoothly and only re-plans less often. Pawns are promoted right away when they take damage, and stay
+ *  promoted for PromotionHoldTime.
+ */
+UCLASS()
+class TETHERED_API UAILODSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Bucket settings, indexed by EAILOD */
+	static FAILODBucket Buckets[static_cast<int32>(EAILOD::Num)];
+
+	/** Time a promoted pawn is kept at full rate */
+	static float PromotionHoldTime;
+
+	/** Starts managing the given AI pawn. It runs at full rate until its first evaluation */
+	void RegisterAI(APawn* Pawn);
+
+	/** Stops managing the given AI pawn and restores its full tick rate */
+	void UnregisterAI(APawn* Pawn);
+
+	/** Moves the pawn to the full rate bucket immediately and holds it there for a while, e.g. after taking damage */
+	void PromoteAI(APawn* Pawn);
+
+	// ~begin USubsystem interface
+	virtual void Deinitialize() override;
+	// ~end USubsystem interface
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Only create the subsystem for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** LOD state of a registered pawn */
+	struct FAILODState
+	{
+		EAILOD LOD = EAILOD::High;
+		double PromotedUntil = 0.0;
+	};
+
+	/** Picks the bucket for a pawn as seen from one viewpoint */
+	EAILOD EvaluateLOD(const APawn& Pawn, const FAILODState& State, const FTransform& Viewpoint) const;
+
+	/** Applies a bucket's tick intervals to the pawn's controller and brain */
+	static void ApplyLOD(APawn& Pawn, EAILOD LOD);
+
+	/** LOD state per registered pawn */
+	TMap<TObjectKey<APawn>, FAILODState> States;
+
+	/** Reused viewpoint list */
+	TArray<FTransform> Viewpoints;
+};
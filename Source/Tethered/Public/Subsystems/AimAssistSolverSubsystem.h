@@ -0,0 +1,158 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "Subsystems/AimableRegistrySubsystem.h"
+#include "Components/AimAssistSelection.h"
+#include "AimAssistSolverSubsystem.generated.h"
+
+class UAimAssistComponent;
+class AAimAssistVisibilityVolume;
+
+/** Result of a shared line of sight request */
+enum class EAimAssistLineOfSight : uint8
+{
+	Visible,
+	Blocked,
+	Pending
+};
+
+/**
+ *  World-level aim assist solver shared by every local player.
+ *  Aim assist components request a query when their scheduler says one is due. Once per frame the solver
+ *  gathers candidates for all requesting players in a single registry query and copies them, along with
+ *  their targetability, into a read-only snapshot that each player's selection task runs against off the
+ *  game thread. Line of sight traces are shared between players (and between consecutive queries) whenever their
+ *  endpoints fall in the same cells. Baked visibility volumes answer line of sight in static arenas
+ *  before any trace is issued.
+ */
+UCLASS()
+class TETHERED_API UAimAssistSolverSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	UAimAssistSolverSubsystem();
+
+	/** Adds a player's aim assist component to the solver */
+	void RegisterPlayer(UAimAssistComponent* Player);
+
+	/** Removes a player's aim assist component from the solver */
+	void UnregisterPlayer(UAimAssistComponent* Player);
+
+	/** Adds a baked visibility grid that is consulted before LOS traces */
+	void RegisterVisibilityVolume(AAimAssistVisibilityVolume* Volume);
+
+	/** Removes a baked visibility grid */
+	void UnregisterVisibilityVolume(AAimAssistVisibilityVolume* Volume);
+
+	/** Asks for a query for this player at the end of the frame */
+	void RequestQuery(UAimAssistComponent* Player);
+
+	/** This frame's candidate snapshot. Selection tasks keep their own reference, so it outlives the frame as needed */
+	const TSharedPtr<const FAimAssistSnapshot, ESPMode::ThreadSafe>& GetSnapshot() const { return Snapshot; }
+
+	/**
+	 *  Returns the baked result if a visibility grid can answer, or a recent LOS result if a trace with matching endpoints already landed.
+	 *  Otherwise joins a matching trace in flight or issues a new one, and the requester is notified
+	 *  through OnSharedLineOfSight when it lands.
+	 */
+	EAimAssistLineOfSight RequestLineOfSight(const FVector& From, AActor* Target, const FVector& To, ECollisionChannel Channel,
+		UAimAssistComponent* Requester, int32 RequestIndex, uint32 QuerySerial);
+
+	/** Global switch for the baked visibility grids - accessible to console commands */
+	static bool bVisibilityGridEnabled;
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Only create the solver for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Gathers the candidates for every requesting player with one registry query and builds the frame's snapshot */
+	void BuildSnapshot(UAimableRegistrySubsystem& AimableRegistry);
+
+	/** Receives a shared async LOS trace */
+	void OnLineOfSightTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	/** Identifies LOS traces with matching endpoints */
+	struct FLineOfSightKey
+	{
+		FIntVector FromCell;
+		FIntVector ToCell;
+		TObjectKey<AActor> Target;
+		uint8 Channel = 0;
+
+		bool operator==(const FLineOfSightKey& Other) const
+		{
+			return FromCell == Other.FromCell && ToCell == Other.ToCell && Target == Other.Target && Channel == Other.Channel;
+		}
+
+		friend uint32 GetTypeHash(const FLineOfSightKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.FromCell), GetTypeHash(Key.ToCell)), HashCombine(GetTypeHash(Key.Target), Key.Channel));
+		}
+	};
+
+	/** A component waiting on a shared trace */
+	struct FLineOfSightWaiter
+	{
+		TWeakObjectPtr<UAimAssistComponent> Requester;
+		int32 RequestIndex = INDEX_NONE;
+		uint32 QuerySerial = 0;
+	};
+
+	/** A shared trace, in flight or recently landed */
+	struct FLineOfSightEntry
+	{
+		TWeakObjectPtr<AActor> Target;
+		uint32 TraceId = 0;
+		double Time = 0.0;
+		bool bDone = false;
+		bool bHasLOS = false;
+		TArray<FLineOfSightWaiter, TInlineAllocator<4>> Waiters;
+	};
+
+	/** Size of the cells trace endpoints are snapped to when matching, in cm. Coarse enough that players standing
+	 *  close together, and a target moving within a frame or two, still match */
+	static constexpr float LineOfSightCellSize = 100.f;
+
+	/** How long a landed LOS result can be reused, in seconds */
+	static constexpr float LineOfSightCacheLifetime = 0.1f;
+
+	/** How long a trace can stay in flight before it's dropped and its waiters are answered as blocked, in seconds */
+	static constexpr float LineOfSightInFlightTimeout = 0.5f;
+
+	/** Registered players */
+	TArray<TWeakObjectPtr<UAimAssistComponent>> Players;
+
+	/** Baked visibility grids in the world */
+	TArray<TWeakObjectPtr<AAimAssistVisibilityVolume>> VisibilityVolumes;
+
+	/** Players that asked for a query this frame */
+	TArray<TWeakObjectPtr<UAimAssistComponent>> QueryRequests;
+
+	/** Registry query scratch */
+	TArray<FAimableCandidate> Candidates;
+
+	/** This frame's candidate snapshot, shared by every player */
+	TSharedPtr<const FAimAssistSnapshot, ESPMode::ThreadSafe> Snapshot;
+
+	/** Shared LOS traces, and the keys of the ones in flight by trace id */
+	TMap<FLineOfSightKey, FLineOfSightEntry> LineOfSightCache;
+	TMap<uint32, FLineOfSightKey> InFlightTraces;
+	uint32 NextTraceId = 1;
+
+	FTraceDelegate LineOfSightTraceDelegate;
+};
@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AimableRegistrySubsystem.generated.h"
+
+/** A single aimable candidate returned by a registry query */
+struct FAimableCandidate
+{
+	/** Registered aimable actor */
+	AActor* Actor = nullptr;
+
+	/** World position of the actor's aim point, refreshed once per frame */
+	FVector AimPoint = FVector::ZeroVector;
+
+	/** Velocity of the actor's root component, refreshed once per frame */
+	FVector Velocity = FVector::ZeroVector;
+};
+
+/**
+ *  World subsystem that tracks every IAimable actor in a uniform 2D grid.
+ *  Aimables register on BeginPlay and unregister on EndPlay or death, so aim assist
+ *  queries only ever see aimable candidates and never touch the physics broadphase.
+ */
+UCLASS()
+class TETHERED_API UAimableRegistrySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Adds an IAimable actor to the registry. Safe to call more than once */
+	UFUNCTION(BlueprintCallable, Category="Aimable")
+	void RegisterAimable(AActor* Aimable);
+
+	/** Removes an actor from the registry. Safe to call for unregistered actors */
+	UFUNCTION(BlueprintCallable, Category="Aimable")
+	void UnregisterAimable(AActor* Aimable);
+
+	/** Returns true if the actor is currently registered */
+	UFUNCTION(BlueprintPure, Category="Aimable")
+	bool IsRegistered(const AActor* Aimable) const { return EntryIndices.Contains(Aimable); }
+
+	/** Returns the number of registered aimables */
+	int32 GetNumAimables() const { return Entries.Num(); }
+
+	/** Collects all registered aimables whose aim point lies within Radius (2D) of Center */
+	void QueryInRadius2D(const FVector& Center, float Radius, TArray<FAimableCandidate>& OutCandidates, const AActor* IgnoreActor = nullptr) const;
+
+	/** Gets the cached aim point of a registered actor. Returns false if the actor isn't registered */
+	bool GetCachedAimPoint(const AActor* Aimable, FVector& OutAimPoint) const;
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Only create the registry for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Registry bookkeeping for a single aimable */
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TObjectKey<AActor> ActorKey;
+		TWeakObjectPtr<USceneComponent> AimPointComponent;
+		FVector AimPoint = FVector::ZeroVector;
+		FVector Velocity = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+	};
+
+	/** Size of a grid cell in cm. Roughly a typical aim assist range divided by four */
+	static constexpr float CellSize = 500.0f;
+
+	/** Returns the grid cell containing the provided location */
+	static FIntPoint GetCell(const FVector& Location);
+
+	/** Samples the current aim point and velocity for an entry */
+	static void SampleEntry(FEntry& Entry);
+
+	/** Removes the entry at the given index, keeping the cell lists consistent */
+	void RemoveEntryAt(int32 Index);
+
+	/** Moves an entry index from one cell list to another */
+	void MoveEntryCell(int32 Index, const FIntPoint& NewCell);
+
+	/** Dense list of registered aimables */
+	TArray<FEntry> Entries;
+
+	/** Lookup from actor to index in the Entries list */
+	TMap<TObjectKey<AActor>, int32> EntryIndices;
+
+	/** Uniform grid of entry indices, keyed by 2D cell coordinates */
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<8>>> Cells;
+};
@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatDamageSubsystem.generated.h"
+
+class UCombatDamageSubsystem;
+
+/** Tick function that drains the damage queue once per frame */
+USTRUCT()
+struct FCombatDamageTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	/** Subsystem to drain */
+	UCombatDamageSubsystem* Target = nullptr;
+
+	// ~begin FTickFunction interface
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+	// ~end FTickFunction interface
+};
+
+template<>
+struct TStructOpsTypeTraits<FCombatDamageTickFunction> : public TStructOpsTypeTraitsBase2<FCombatDamageTickFunction>
+{
+	enum { WithCopy = false };
+};
+
+/**
+ *  Frame-batched damage pipeline for ICombatDamageable.
+ *  Hits are queued as they are found and drained once per frame in TG_PostPhysics. All hits on the same target
+ *  during a frame are coalesced into a single ApplyDamage call, so a multi-hit frame costs each target one
+ *  TakeDamage, one montage interruption and one round of physics and UI updates instead of one per hit.
+ */
+UCLASS()
+class TETHERED_API UCombatDamageSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Queues a hit on the target for this frame's drain */
+	void QueueDamage(AActor* Target, float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse);
+
+	/** Queues a hit through the target world's damage subsystem, or applies it right away if the world has none */
+	static void ApplyOrQueueDamage(AActor* Target, float Damage, AActor* DamageCauser, const FVector& DamageLocation, const FVector& DamageImpulse);
+
+	/** Applies every queued hit. Hits queued while draining wait for the next frame */
+	void Drain();
+
+	/** Returns the number of targets waiting for damage */
+	int32 GetNumPending() const { return Pending.Num(); }
+
+	// ~begin USubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	// ~end USubsystem interface
+
+protected:
+
+	/** Only create the queue for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** All damage dealt to a single target this frame */
+	struct FPendingDamage
+	{
+		TWeakObjectPtr<AActor> Target;
+
+		/** Causer and location of the strongest hit */
+		TWeakObjectPtr<AActor> DamageCauser;
+		FVector DamageLocation = FVector::ZeroVector;
+		float StrongestHit = -1.0f;
+
+		/** Summed damage and knockback of every hit */
+		float Damage = 0.0f;
+		FVector DamageImpulse = FVector::ZeroVector;
+	};
+
+	/** Targets hit this frame */
+	TArray<FPendingDamage> Pending;
+
+	/** Lookup from target to index in the Pending list */
+	TMap<TObjectKey<AActor>, int32> PendingIndices;
+
+	/** Swap buffer for the list being drained */
+	TArray<FPendingDamage> Draining;
+
+	/** Drains the queue in a fixed tick group */
+	FCombatDamageTickFunction DrainTick;
+};
@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatSpawnSchedulerSubsystem.generated.h"
+
+class ACombatEnemySpawner;
+
+/**
+ *  Spreads enemy spawns over several frames.
+ *  Spawners queue a request instead of spawning on the spot, so an activation volume waking up a whole encounter,
+ *  or a chain of depleted spawners, doesn't put every spawn in the same frame. Each frame, requests are served
+ *  nearest to any player first until either the spawn count or the time budget runs out. At least one request is
+ *  served per frame, so the queue always drains.
+ *  Spawner pool warm-ups are queued too, at low priority: they only use whatever budget the spawns left over, one
+ *  pooled enemy per request, so prefetching a whole encounter doesn't create all of its enemies in one frame.
+ */
+UCLASS()
+class TETHERED_API UCombatSpawnSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Maximum number of spawns served per frame */
+	static int32 MaxSpawnsPerFrame;
+
+	/** Time in milliseconds after which no more spawns are served this frame */
+	static float SpawnBudgetMs;
+
+	/** Queues a spawn for the given spawner. A spawner has at most one request queued at a time */
+	void RequestSpawn(ACombatEnemySpawner* Spawner);
+
+	/** Queues a low priority pool warm-up for the given spawner, served one pooled enemy at a time */
+	void RequestPoolWarmup(ACombatEnemySpawner* Spawner);
+
+	/** Drops the spawner's queued spawn and warm-up requests, if any */
+	void CancelSpawn(ACombatEnemySpawner* Spawner);
+
+	/** Returns the number of queued requests */
+	int32 GetNumPendingSpawns() const { return Pending.Num(); }
+
+	// ~begin USubsystem interface
+	virtual void Deinitialize() override;
+	// ~end USubsystem interface
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Only create the scheduler for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Sorts the queue so the spawners nearest to any player come first */
+	void SortByPriority();
+
+	/** Spawners waiting for their spawn, in request order until sorted */
+	TArray<TWeakObjectPtr<ACombatEnemySpawner>> Pending;
+
+	/** Spawners waiting to warm their pool, in request order */
+	TArray<TWeakObjectPtr<ACombatEnemySpawner>> PendingWarmups;
+};
@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/LineBatchComponent.h"
+#include "DebugDrawSubsystem.generated.h"
+
+class UCanvas;
+class APlayerController;
+
+/**
+ *  Retained debug drawing layer for gameplay visualizers.
+ *  Shape geometry (spheres, arcs, cones) is built once in unit space and cached, so per-frame drawing
+ *  only transforms cached segments. Every line queued during a frame is submitted to the world line
+ *  batcher in a single call, and every label is drawn in one canvas pass.
+ *  Not created when debug drawing is compiled out.
+ */
+UCLASS()
+class TETHERED_API UDebugDrawSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Identifies a cached unit shape */
+	using FShapeId = uint64;
+
+	/** Unit sphere drawn as one horizontal and two vertical great circles */
+	static FShapeId SphereShape(int32 Segments);
+
+	/** Unit radius arc in the XY plane centered on +X, with edges back to the origin */
+	static FShapeId ArcShape(float AngleDeg, int32 Segments);
+
+	/** Unit length cone along +X */
+	static FShapeId ConeShape(float HalfAngleDeg, int32 Sides);
+
+	/** Queues a cached shape. A zero lifetime draws it for this frame only */
+	void AddShape(FShapeId Shape, const FTransform& Transform, const FColor& Color, float Thickness = 0.f, float LifeTime = 0.f);
+
+	/** Queues a single line */
+	void AddLine(const FVector& Start, const FVector& End, const FColor& Color, float Thickness = 0.f, float LifeTime = 0.f);
+
+	/** Queues an arrow from Start to End */
+	void AddArrow(const FVector& Start, const FVector& End, float ArrowSize, const FColor& Color, float Thickness = 0.f, float LifeTime = 0.f);
+
+	/** Queues a world space label, drawn in the canvas pass */
+	void AddText(const FVector& Location, FString Text, const FColor& Color, float LifeTime = 0.f);
+
+	// ~begin USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	// ~end USubsystem interface
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Only create the layer for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** A label waiting for the canvas pass */
+	struct FLabel
+	{
+		FVector Location;
+		FString Text;
+		FColor Color;
+		float RemainingTime;
+	};
+
+	/** Returns the cached unit segments for a shape, building them on first use */
+	const TArray<FVector3f>& GetShapeSegments(FShapeId Shape);
+
+	/** Draws all visible labels in a single pass */
+	void DrawLabels(UCanvas* Canvas, APlayerController* PlayerController);
+
+	/** Unit space line segments, stored as start/end pairs */
+	TMap<FShapeId, TArray<FVector3f>> ShapeCache;
+
+	/** Returns the queue for lines with the given lifetime */
+	TArray<FBatchedLine>& GetLineQueue(float LifeTime) { return LifeTime > 0.f ? PendingTimedLines : PendingLines; }
+
+	/** Single frame and timed lines queued since the last flush */
+	TArray<FBatchedLine> PendingLines;
+	TArray<FBatchedLine> PendingTimedLines;
+
+	/** Labels queued since the last flush, and the ones being drawn this frame */
+	TArray<FLabel> PendingLabels;
+	TArray<FLabel> VisibleLabels;
+
+	/** Debug draw service registration for the canvas pass */
+	FDelegateHandle DrawLabelsHandle;
+};
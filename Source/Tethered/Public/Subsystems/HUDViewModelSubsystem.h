@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HUDViewModelSubsystem.generated.h"
+
+class FHUDViewModel;
+
+/**
+ *  Flushes dirty HUD view models into their widgets.
+ *  Tickables run after the actor tick groups, so every gameplay change of the frame is in before the flush,
+ *  and each dirty model refreshes its widget exactly once before Slate paints.
+ */
+UCLASS()
+class TETHERED_API UHUDViewModelSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Queues a view model for this frame's flush. Queuing it again before the flush does nothing */
+	void Enqueue(FHUDViewModel& ViewModel);
+
+	/** Removes a view model from the queue, e.g. when it's destroyed */
+	void Cancel(FHUDViewModel& ViewModel);
+
+	// ~begin USubsystem interface
+	virtual void Deinitialize() override;
+	// ~end USubsystem interface
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Only create the subsystem for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** View models waiting for the flush */
+	TArray<FHUDViewModel*> Pending;
+
+	/** View models being flushed this frame, reused between frames */
+	TArray<FHUDViewModel*> Flushing;
+};
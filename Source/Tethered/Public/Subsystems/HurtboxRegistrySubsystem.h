@@ -0,0 +1,149 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HurtboxRegistrySubsystem.generated.h"
+
+class AActor;
+class UPrimitiveComponent;
+
+/** Which side a hurtbox belongs to. Queries pass a mask of the factions they can hit */
+enum class EHurtboxFaction : uint8
+{
+	None	= 0,
+	Player	= 1 << 0,
+	Enemy	= 1 << 1,
+	Prop	= 1 << 2
+};
+ENUM_CLASS_FLAGS(EHurtboxFaction)
+
+/**
+ *  Gameplay-side registry of combat hurtboxes, answering melee and area queries without Chaos scene queries.
+ *  Every registered component is reduced to a capsule (capsule components exactly, anything else from its bounds)
+ *  and stored in structure-of-arrays slots grouped four to a BVH leaf. The tree is refit from the current
+ *  component transforms on the first query of each frame and rebuilt only when membership changes or its
+ *  shape has had time to degrade. Leaves are tested four capsules at a time against the swept sphere.
+ *  Game thread only.
+ */
+UCLASS()
+class TETHERED_API UHurtboxRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** When false, melee sweeps go through physics scene queries instead of the registry */
+	static bool bRegistryEnabled;
+
+	/** Adds a hurtbox component for the given faction. Safe to call more than once */
+	void RegisterHurtbox(UPrimitiveComponent* Component, EHurtboxFaction Faction);
+
+	/** Removes a hurtbox component. Safe to call for unregistered components */
+	void UnregisterHurtbox(UPrimitiveComponent* Component);
+
+	/** Returns the number of registered hurtboxes */
+	int32 GetNumHurtboxes() const { return Entries.Num(); }
+
+	/**
+	 *  Sweeps a sphere from Start to End against every hurtbox of the given factions.
+	 *  Returns true if anything was hit, with one hit per touched hurtbox in OutHits.
+	 */
+	bool SweepSphere(const FVector& Start, const FVector& End, float Radius, EHurtboxFaction Factions, const AActor* IgnoreActor, TArray<FHitResult>& OutHits);
+
+	/** Sweeps through the world's registry when enabled, or through the physics scene using the faction collision channels */
+	static bool SweepMelee(UWorld& World, const FVector& Start, const FVector& End, float Radius, EHurtboxFaction Factions, const AActor* IgnoreActor, TArray<FHitResult>& OutHits);
+
+	// ~begin USubsystem interface
+	virtual void Deinitialize() override;
+	// ~end USubsystem interface
+
+protected:
+
+	/** Only create the registry for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Registry bookkeeping for a single hurtbox */
+	struct FEntry
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Component;
+		TObjectKey<UPrimitiveComponent> ComponentKey;
+		TWeakObjectPtr<AActor> Actor;
+		EHurtboxFaction Faction = EHurtboxFaction::None;
+
+		/** SoA slot holding the capsule, assigned by the last build */
+		int32 Slot = INDEX_NONE;
+	};
+
+	/** A BVH node. Leaves own exactly LeafSize consecutive slots */
+	struct FNode
+	{
+		FVector3f Min = FVector3f::ZeroVector;
+		FVector3f Max = FVector3f::ZeroVector;
+		int32 Left = INDEX_NONE;
+		int32 Right = INDEX_NONE;
+		int32 FirstSlot = INDEX_NONE;
+
+		/** Factions present anywhere below this node */
+		EHurtboxFaction Factions = EHurtboxFaction::None;
+
+		bool IsLeaf() const { return FirstSlot != INDEX_NONE; }
+	};
+
+	/** Capsules per leaf, one per SIMD lane */
+	static constexpr int32 LeafSize = 4;
+
+	/** Refits between full rebuilds while membership is unchanged */
+	static constexpr int32 RebuildInterval = 60;
+
+	/** Refits the tree to the current transforms, once per frame */
+	void RefitIfNeeded();
+
+	/** Rebuilds the tree topology and slot assignment */
+	void Build();
+
+	/** Builds the subtree over Order[Begin, End) and returns its node index */
+	int32 BuildNode(int32 Begin, int32 End, const TArray<FVector3f>& Centers);
+
+	/** Writes the current capsule of an entry into its slot */
+	void SampleEntry(const FEntry& Entry);
+
+	/** Recomputes a leaf's bounds from its slots */
+	void RefitLeaf(FNode& Node) const;
+
+	/** Removes the entry at the given index */
+	void RemoveEntryAt(int32 Index);
+
+	/** Registered hurtboxes */
+	TArray<FEntry> Entries;
+
+	/** Lookup from component to index in the Entries list */
+	TMap<TObjectKey<UPrimitiveComponent>, int32> EntryIndices;
+
+	/** Capsule segments and radii by slot, padded to whole leaves */
+	TArray<float, TAlignedHeapAllocator<16>> AX, AY, AZ, BX, BY, BZ, R;
+
+	/** Entry index by slot, INDEX_NONE for padding */
+	TArray<int32> SlotEntries;
+
+	/** Tree nodes; children always follow their parent */
+	TArray<FNode> Nodes;
+
+	/** Entry order used while building */
+	TArray<int32> BuildOrder;
+
+	/** Scratch traversal stack */
+	TArray<int32> Stack;
+
+	/** Frame of the last refit */
+	uint64 LastRefitFrame = MAX_uint64;
+
+	/** Refits since the last build */
+	int32 RefitsSinceBuild = 0;
+
+	/** Set when membership changed since the last build */
+	bool bTopologyDirty = true;
+};
@@ -0,0 +1,108 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "LifeBarSubsystem.generated.h"
+
+class USceneComponent;
+class ULocalPlayer;
+class SLifeBarLayer;
+
+/** A life bar projected to the screen this frame, in viewport pixels */
+struct FProjectedLifeBar
+{
+	FVector2f ScreenPosition;
+	float Percent;
+	FLinearColor Color;
+};
+
+/**
+ *  Screen-space life bars for every registered health owner.
+ *  Owners register an anchor component once and push health changes by handle. Once per frame the subsystem
+ *  projects all visible bars with one view projection per local player, drops the ones that are too far away
+ *  or off that player's screen, and hands the survivors to one viewport layer that draws them all in a single
+ *  batched Slate pass. Split screen players each get their own copy of the bars inside their own view.
+ *  Bar slots are recycled, so registering doesn't allocate once the pool has grown to the peak enemy count.
+ */
+UCLASS()
+class TETHERED_API ULifeBarSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Bar size in Slate units */
+	FVector2f BarSize = FVector2f(80.0f, 8.0f);
+
+	/** Bars further than this from the camera are not drawn */
+	float MaxDrawDistance = 3000.0f;
+
+	/** Color of the empty part of the bar */
+	FLinearColor BackgroundColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.6f);
+
+	/** Adds a life bar that follows the anchor at the given world offset. Returns a handle for the other calls */
+	int32 RegisterLifeBar(USceneComponent* Anchor, const FVector& Offset, const FLinearColor& Color);
+
+	/** Removes a life bar and resets the handle. Safe to call with an invalid handle */
+	void UnregisterLifeBar(int32& Handle);
+
+	/** Sets the bar fill to a 0-1 percentage */
+	void SetLifePercentage(int32 Handle, float Percent);
+
+	/** Sets the bar fill color */
+	void SetBarColor(int32 Handle, const FLinearColor& Color);
+
+	/** Shows or hides a bar without giving up its slot */
+	void SetLifeBarVisible(int32 Handle, bool bVisible);
+
+	/** Bars that passed culling this frame, for every local player's view */
+	const TArray<FProjectedLifeBar>& GetProjectedBars() const { return ProjectedBars; }
+
+	// ~begin USubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	// ~end USubsystem interface
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Only create the layer for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** A registered life bar */
+	struct FLifeBar
+	{
+		TWeakObjectPtr<USceneComponent> Anchor;
+		FVector Offset = FVector::ZeroVector;
+		FLinearColor Color = FLinearColor::Red;
+		float Percent = 1.0f;
+		bool bVisible = true;
+		bool bInUse = false;
+	};
+
+	/** Projects every visible bar into each local player's view and keeps the ones on screen */
+	void ProjectBars();
+
+	/** Projects every visible bar into a single local player's view */
+	void ProjectBarsForPlayer(ULocalPlayer& LocalPlayer, bool bSplitScreen);
+
+	/** Bar slots, indexed by handle */
+	TArray<FLifeBar> Bars;
+
+	/** Slots released by unregistered bars */
+	TArray<int32> FreeSlots;
+
+	/** Bars that passed culling this frame */
+	TArray<FProjectedLifeBar> ProjectedBars;
+
+	/** Viewport layer drawing the projected bars */
+	TSharedPtr<SLifeBarLayer> Layer;
+};
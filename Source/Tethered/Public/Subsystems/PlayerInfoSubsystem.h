@@ -0,0 +1,64 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PlayerInfoSubsystem.generated.h"
+
+class APawn;
+
+/** Snapshot of one player's pawn for the current frame */
+struct FPlayerInfo
+{
+	/** Pawn possessed by the player */
+	TWeakObjectPtr<APawn> Pawn;
+
+	/** Pawn location at the time of the snapshot */
+	FVector Location = FVector::ZeroVector;
+
+	/** Pawn velocity at the time of the snapshot */
+	FVector Velocity = FVector::ZeroVector;
+
+	/** Index of the player, matching UGameplayStatics::GetPlayerController */
+	int32 PlayerIndex = INDEX_NONE;
+};
+
+/**
+ *  Per-frame cache of every player's pawn, shared by AI tasks and EQS contexts.
+ *  The snapshot is taken by the first query of each frame and reused by every later one, so a crowd of enemies
+ *  looking for the player costs one walk over the player controllers instead of one per enemy. Only players that
+ *  currently possess a pawn are included, which makes every local co-op player a valid target.
+ */
+UCLASS()
+class TETHERED_API UPlayerInfoSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Returns this frame's snapshot of every player with a pawn */
+	const TArray<FPlayerInfo>& GetPlayers();
+
+	/**
+	 *  Returns the player nearest to the given point, or nullptr if no player has a pawn.
+	 *  The pointer is only valid until the end of the frame
+	 */
+	const FPlayerInfo* FindNearestPlayer(const FVector& Point, float* OutDistance = nullptr);
+
+protected:
+
+	/** Only create the cache for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** Retakes the snapshot if it was taken on an earlier frame */
+	void RefreshIfStale();
+
+	/** Player snapshots, in player index order */
+	TArray<FPlayerInfo> Players;
+
+	/** Frame the snapshot was taken on */
+	uint64 SnapshotFrame = MAX_uint64;
+};
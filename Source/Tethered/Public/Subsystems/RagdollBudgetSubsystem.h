@@ -0,0 +1,76 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RagdollBudgetSubsystem.generated.h"
+
+class USkeletalMeshComponent;
+
+/**
+ *  Caps the number of ragdolls simulating at the same time.
+ *  Death handlers register their mesh after switching it to physics. Ragdolls that have come to rest are frozen
+ *  right away, and whenever more than MaxActiveRagdolls are simulating, the ones farthest from the local camera
+ *  (or the oldest, with no camera) are frozen until the count fits. Freezing stops the simulation and keeps the
+ *  last simulated pose as a static snapshot. Usage is reported in the Ragdolls stat group.
+ */
+UCLASS()
+class TETHERED_API URagdollBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Maximum number of ragdolls simulating at once */
+	static int32 MaxActiveRagdolls;
+
+	/**
+	 *  Adds a mesh that just started simulating. Meshes that can't be frozen, like the player's,
+	 *  still count against the budget but are never picked for freezing
+	 */
+	void RegisterRagdoll(USkeletalMeshComponent* Mesh, bool bCanFreeze = true);
+
+	/** Removes a mesh, restoring its skeleton updates if it had been frozen. Safe to call for unregistered meshes */
+	void UnregisterRagdoll(USkeletalMeshComponent* Mesh);
+
+	/** Returns the number of registered ragdolls still simulating */
+	int32 GetNumActiveRagdolls() const;
+
+	/** Returns the number of registered ragdolls frozen into a snapshot */
+	int32 GetNumFrozenRagdolls() const { return Ragdolls.Num() - GetNumActiveRagdolls(); }
+
+	// ~begin USubsystem interface
+	virtual void Deinitialize() override;
+	// ~end USubsystem interface
+
+	// ~begin UTickableWorldSubsystem interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	// ~end UTickableWorldSubsystem interface
+
+protected:
+
+	/** Only create the budget for game worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	/** A registered ragdoll */
+	struct FRagdoll
+	{
+		TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+		double StartTime = 0.0;
+		bool bCanFreeze = true;
+		bool bFrozen = false;
+	};
+
+	/** Stops the simulation and holds the current pose */
+	static void Freeze(FRagdoll& Ragdoll);
+
+	/** Freezes ragdolls until the active count fits the budget */
+	void EnforceBudget();
+
+	/** Registered ragdolls in registration order */
+	TArray<FRagdoll> Ragdolls;
+};
@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCombatLifeBar;
+class USideScrollingUI;
+class UUserWidget;
+class UHUDViewModelSubsystem;
+
+/**
+ *  Base for the values gameplay shows on the HUD.
+ *  Setters only store the value and mark the model dirty; dirty models are refreshed into their widget once per
+ *  frame by UHUDViewModelSubsystem, so a frame with many changes costs one widget update. Widgets are only touched
+ *  when a value actually changed, which keeps them cacheable inside invalidation panels.
+ */
+class TETHERED_API FHUDViewModel
+{
+public:
+
+	FHUDViewModel() = default;
+	virtual ~FHUDViewModel();
+
+	FHUDViewModel(const FHUDViewModel&) = delete;
+	FHUDViewModel& operator=(const FHUDViewModel&) = delete;
+
+protected:
+
+	/** Queues a refresh for the end of the frame, once. Does nothing until a widget is bound */
+	void MarkDirty();
+
+	/** Binds the widget that refreshes go to, and queues a full refresh */
+	void BindWidget(UUserWidget* InWidget);
+
+	/** Pushes the dirty values into the widget */
+	virtual void Refresh() = 0;
+
+	/** Widget the values are pushed to */
+	TWeakObjectPtr<UUserWidget> Widget;
+
+	/** True when every value should be pushed, after binding */
+	bool bRefreshAll = false;
+
+private:
+
+	friend UHUDViewModelSubsystem;
+
+	/** Subsystem holding the queued refresh, if any */
+	TWeakObjectPtr<UHUDViewModelSubsystem> QueuedIn;
+};
+
+/** Fill and color of a UCombatLifeBar */
+class TETHERED_API FLifeBarViewModel : public FHUDViewModel
+{
+public:
+
+	/** Binds the life bar widget */
+	void Bind(UCombatLifeBar* InWidget);
+
+	/** Sets the 0-1 fill percentage */
+	void SetLifePercentage(float InPercent);
+
+	/** Sets the fill color */
+	void SetBarColor(const FLinearColor& InColor);
+
+protected:
+
+	virtual void Refresh() override;
+
+private:
+
+	float Percent = 1.0f;
+	FLinearColor Color = FLinearColor::Red;
+	bool bPercentDirty = false;
+	bool bColorDirty = false;
+};
+
+/** Pickup count shown by USideScrollingUI */
+class TETHERED_API FPickupCounterViewModel : public FHUDViewModel
+{
+public:
+
+	/** Binds the side scrolling UI widget */
+	void Bind(USideScrollingUI* InWidget);
+
+	/** Sets the number of pickups collected */
+	void SetPickups(int32 InPickups);
+
+protected:
+
+	virtual void Refresh() override;
+
+private:
+
+	int32 Pickups = 0;
+};
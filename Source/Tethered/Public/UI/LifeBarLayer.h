@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class ULifeBarSubsystem;
+
+/**
+ *  Viewport layer that draws every life bar projected by the life bar subsystem.
+ *  All backgrounds share one brush and layer, and so do all fills, so Slate batches the whole set into two draws.
+ */
+class TETHERED_API SLifeBarLayer : public SLeafWidget
+{
+public:
+
+	SLATE_BEGIN_ARGS(SLifeBarLayer) {}
+		SLATE_ARGUMENT(TWeakObjectPtr<const ULifeBarSubsystem>, Subsystem)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements,
+		int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+
+private:
+
+	/** Source of the projected bars */
+	TWeakObjectPtr<const ULifeBarSubsystem> Subsystem;
+
+	/** Plain white brush tinted per bar */
+	const FSlateBrush* Brush = nullptr;
+};
@@ -10,7 +10,7 @@ public class Tethered : ModuleRules
 
         PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "GameplayAbilities", "AIModule", "StateTreeModule", "GameplayStateTreeModule", "UMG", "Slate"});
 
-        PrivateDependencyModuleNames.AddRange(new string[] { "GameplayTags", "GameplayTasks", "NavigationSystem", "Niagara" });
+        PrivateDependencyModuleNames.AddRange(new string[] { "GameplayTags", "GameplayTasks", "NavigationSystem", "Niagara", "SlateCore", "SignificanceManager" });
 
 
         // Uncomment if you are using Slate UI